@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <unordered_map>
+#include <vector>
+
+class Circle;
+class Line;
+class Rect;
+class Vec2;
+
+namespace py = pybind11;
+
+namespace aabb_tree
+{
+void _bind(py::module_& module);
+} // namespace aabb_tree
+
+// A dynamic bounding volume hierarchy over axis-aligned boxes keyed by integer ids. Nodes live
+// in a pool and link to each other by index. Leaves store a box enlarged by a margin, so small
+// moves only update the leaf and leave the tree untouched
+class AABBTree
+{
+  public:
+    struct Box
+    {
+        double minX, minY, maxX, maxY;
+    };
+
+    explicit AABBTree(double margin = 4.0);
+    ~AABBTree() = default;
+
+    void insert(int64_t id, const Rect& rect);
+
+    void insert(int64_t id, const Circle& circle);
+
+    void move(int64_t id, const Rect& rect);
+
+    void move(int64_t id, const Circle& circle);
+
+    void remove(int64_t id);
+
+    void clear();
+
+    void rebuild();
+
+    bool contains(int64_t id) const;
+
+    size_t getCount() const;
+
+    double getMargin() const;
+
+    int getHeight() const;
+
+    py::array_t<int64_t> queryRect(const Rect& rect) const;
+
+    py::array_t<int64_t> queryPoint(const Vec2& point) const;
+
+    py::array_t<int64_t> queryCircle(const Circle& circle) const;
+
+    py::array_t<int64_t> raycast(const Line& line) const;
+
+  private:
+    struct Node
+    {
+        Box box;   // Enlarged by the margin for leaves
+        Box tight; // The exact bounds, only used by leaves
+        int parent;
+        int left;  // -1 for leaves
+        int right; // Doubles as the next free node while pooled
+        int height;
+        int64_t id;
+    };
+
+    double m_margin;
+    std::vector<Node> m_nodes;
+    std::unordered_map<int64_t, int> m_leaves;
+    int m_root = -1;
+    int m_free = -1;
+
+    int allocateNode();
+
+    void freeNode(int index);
+
+    void add(int64_t id, const Box& box);
+
+    void update(int64_t id, const Box& box);
+
+    void insertLeaf(int leaf);
+
+    void removeLeaf(int leaf);
+
+    void refit(int index);
+
+    int balance(int index);
+
+    int build(int* leaves, int count, int depth);
+
+    // Call fn(leaf) for every leaf whose enlarged box passes test(box)
+    template <typename Test, typename Fn>
+    void traverse(Test&& test, Fn&& fn) const;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <pybind11/pybind11.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+class PixelArray;
+class Texture;
+
+namespace py = pybind11;
+
+namespace asset_loader
+{
+void _bind(py::module_& module);
+} // namespace asset_loader
+
+// The pending result of an AssetLoader request. Decoding fills it on a loader thread; texture
+// uploads happen on the main thread in AssetLoader::update() or get()
+class AssetHandle
+{
+  public:
+    enum class Kind
+    {
+        PIXEL_ARRAY,
+        TEXTURE,
+    };
+
+    AssetHandle(std::string filePath, Kind kind, bool premultiplied);
+    ~AssetHandle() = default;
+
+    const std::string& getPath() const;
+
+    Kind getKind() const;
+
+    bool isDone() const;
+
+    bool isFailed() const;
+
+    std::string getError() const;
+
+    py::object get();
+
+    // Decode the image file; safe to call without the GIL
+    void _decode();
+
+    // Create the texture from the decoded pixels. Returns false if there was nothing to upload
+    bool _upload();
+
+    // Whether the decoded pixels are still waiting to become a texture
+    bool _isAwaitingUpload() const;
+
+    void _cancel(const std::string& reason);
+
+  private:
+    enum class Status
+    {
+        PENDING,
+        DECODED,
+        READY,
+        FAILED,
+    };
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_decoded;
+    const std::string m_path;
+    const Kind m_kind;
+    const bool m_premultiplied;
+    Status m_status = Status::PENDING;
+    std::string m_error;
+    std::shared_ptr<PixelArray> m_pixelArray;
+    std::shared_ptr<Texture> m_texture;
+};
+
+class AssetLoader
+{
+  public:
+    explicit AssetLoader(int threads = 0);
+    ~AssetLoader();
+
+    std::shared_ptr<AssetHandle> loadTexture(const std::string& filePath,
+                                             bool premultiplied = false);
+
+    std::shared_ptr<AssetHandle> loadPixelArray(const std::string& filePath,
+                                                bool premultiplied = false);
+
+    int update(double budgetMs = 2.0);
+
+    int getPendingCount() const;
+
+  private:
+    std::vector<std::thread> m_workers;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::deque<std::shared_ptr<AssetHandle>> m_queue;   // Waiting to be decoded
+    std::deque<std::shared_ptr<AssetHandle>> m_uploads; // Decoded textures, in completion order
+    int m_decoding = 0;
+    bool m_stopping = false;
+
+    std::shared_ptr<AssetHandle> enqueue(const std::string& filePath, AssetHandle::Kind kind,
+                                         bool premultiplied);
+
+    void workerLoop();
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <vector>
+
+namespace batch
+{
+struct Quad
+{
+    SDL_FRect dst{};
+    SDL_FRect src{};
+    double angle = 0.0;
+    SDL_FlipMode flip = SDL_FLIP_NONE;
+    SDL_FColor color{1.f, 1.f, 1.f, 1.f};
+};
+
+void begin();
+
+void end();
+
+bool isActive();
+
+// Queue a textured quad; the destination is expected in screen space (camera already applied)
+void add(SDL_Texture* texture, const Quad& quad);
+
+// Submit every queued quad, one SDL_RenderGeometry call per texture/blend-mode run
+void flush();
+
+// Append the four vertices and six indices of a quad to the given buffers
+void appendQuad(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices, const Quad& quad,
+                float texWidth, float texHeight);
+} // namespace batch
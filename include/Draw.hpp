@@ -17,18 +17,32 @@ namespace draw
 void _bind(py::module_& module);
 
 void circle(const Circle& circle, const Color& color, int thickness = 0);
+void circles(const std::vector<Circle>& circles, const Color& color, int thickness = 0);
+void circlesFromNDarray(py::array_t<double, py::array::c_style | py::array::forcecast> arr,
+                        const Color& color, int thickness = 0, py::object colors = py::none());
+
+void ellipse(Rect rect, const Color& color, int thickness = 0);
 
 void point(const Vec2& point, const Color& color);
-void points(const std::vector<Vec2>& points, const Color& color);
+void points(const std::vector<Vec2>& points, const Color& color,
+            py::object colors = py::none());
 void pointsFromNDarray(py::array_t<double, py::array::c_style | py::array::forcecast> arr,
-                       const Color& color);
+                       const Color& color, py::object colors = py::none());
 
 void line(const Line& line, const Color& color, int thickness = 1);
-// void drawLines(const std::vector<Line>& lines, const Color& color, int thickness = 1);
+void lines(const std::vector<Line>& lines, const Color& color, int thickness = 1);
+void linesFromNDarray(py::array_t<double, py::array::c_style | py::array::forcecast> arr,
+                      const Color& color, int thickness = 1, py::object colors = py::none());
 
 void rect(Rect rect, const Color& color, int thickness = 0);
-void rects(const std::vector<Rect>& rects, const Color& color, int thickness = 0);
+void rects(const std::vector<Rect>& rects, const Color& color, int thickness = 0,
+           py::object colors = py::none());
+void rectsFromNDarray(py::array_t<double, py::array::c_style | py::array::forcecast> arr,
+                      const Color& color, py::object colors = py::none());
 
 void polygon(const Polygon& polygon, const Color& color, bool filled = false);
-// void drawPolygons(const std::vector<Polygon>& polygons, const Color& color, bool filled = false);
+void polygons(const std::vector<Polygon>& polygons, const Color& color, bool filled = false);
+void polygonsFromNDarray(py::array_t<double, py::array::c_style | py::array::forcecast> vertices,
+                         py::array_t<int64_t, py::array::c_style | py::array::forcecast> offsets,
+                         const Color& color, bool filled = false, py::object colors = py::none());
 } // namespace draw
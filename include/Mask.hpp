@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <pybind11/pybind11.h>
 #include <vector>
 
@@ -31,7 +32,7 @@ class Mask
     bool getAt(const Vec2& pos) const;
 
     void setAt(const Vec2& pos, bool value);
-    
+
     int getOverlapArea(const Mask& other, const Vec2& offset) const;
 
     Mask getOverlapMask(const Mask& other, const Vec2& offset) const;
@@ -68,6 +69,34 @@ class Mask
     int getHeight() const;
 
   private:
-    int m_width, m_height;
-    std::vector<bool> m_maskData;
+    int m_width = 0;
+    int m_height = 0;
+    int m_stride = 0;              // 64-bit words per row
+    std::vector<uint64_t> m_words; // Bit x of row y is bit x % 64 of word y * m_stride + x / 64
+
+    // Coarse occupancy, rebuilt on demand after the pixels change. Bit bx of block row by is set
+    // if the 8x8 block at (bx * 8, by * 8) has a solid pixel
+    mutable bool m_summaryDirty = true;
+    mutable int m_blockStride = 0; // 64-bit words per block row
+    mutable std::vector<uint64_t> m_blocks;
+    mutable int m_minX = 0; // Tight bounds of the solid pixels, inclusive. m_maxY < 0 when empty
+    mutable int m_minY = 0;
+    mutable int m_maxX = -1;
+    mutable int m_maxY = -1;
+
+    const uint64_t* row(int y) const;
+
+    uint64_t* row(int y);
+
+    const uint64_t* blockRow(int by) const;
+
+    void updateSummary() const;
+
+    // Zero the bits past the right edge, which every overlap kernel relies on
+    void clearPadding();
+
+    // Call fn(y, word, thisBits, otherBits) for every word of this mask that the other mask,
+    // placed at the offset, overlaps. Stops early when fn returns false
+    template <typename Fn>
+    void forEachOverlap(const Mask& other, int xOffset, int yOffset, Fn&& fn) const;
 };
@@ -2,6 +2,7 @@
 
 #include <SDL3/SDL.h>
 #include <memory>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <string>
 
@@ -16,6 +17,12 @@ class Rect;
 namespace pixel_array
 {
 void _bind(py::module_& module);
+
+// Create an RGBA32 copy of any surface. 8-bit-per-channel formats are swizzled directly
+SDL_Surface* _convertRGBA32(SDL_Surface* surface);
+
+// Multiply the color channels of an RGBA32 surface by its alpha in place
+void _premultiply(SDL_Surface* surface);
 } // namespace pixel_array
 
 // enum class ScrollType
@@ -31,9 +38,11 @@ class PixelArray
     PixelArray() = default;
     PixelArray(SDL_Surface* sdlSurface);
     PixelArray(const Vec2& size);
-    PixelArray(const std::string& filePath);
+    PixelArray(const std::string& filePath, bool premultiplied = false);
     ~PixelArray();
 
+    static std::unique_ptr<PixelArray> fromNumpy(py::array arr, bool copy);
+
     void fill(const Color& color) const;
 
     void blit(const PixelArray& other, const Vec2& pos, Anchor anchor, py::object srcRect) const;
@@ -62,8 +71,30 @@ class PixelArray
 
     SDL_Surface* getSDL() const;
 
+    bool isPremultiplied() const;
+
+    void setPremultiplied(bool premultiplied);
+
+    // Whether a buffer view of the pixels is alive
+    bool isExported() const;
+
+    // Track buffer views; called by the buffer protocol slots
+    void _addExport();
+
+    void _removeExport();
+
+    // Swap in a new surface, returning the previous one if it owned its pixels (else nullptr).
+    // Throws BufferError while a buffer view of the current pixels is alive
+    SDL_Surface* replaceSDL(SDL_Surface* sdlSurface);
+
     std::unique_ptr<PixelArray> copy() const;
 
+    // Expose the pixels as an (H,W,4) RGBA view, converting the surface to RGBA32 if needed
+    py::buffer_info getBuffer();
+
   private:
     SDL_Surface* m_surface = nullptr;
+    py::object m_owner; // Keeps a borrowed NumPy array alive for zero-copy surfaces
+    bool m_premultiplied = false;
+    int m_exports = 0; // Buffer views of m_surface's pixels that are still alive
 };
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+#include "Texture.hpp"
+
+class Vec2;
+
+namespace py = pybind11;
+
+namespace render_target
+{
+void _bind(py::module_& module);
+} // namespace render_target
+
+class RenderTarget final : public Texture
+{
+  public:
+    explicit RenderTarget(const Vec2& size);
+    ~RenderTarget() override;
+};
@@ -2,6 +2,7 @@
 
 #include <SDL3/SDL.h>
 #include <pybind11/pybind11.h>
+#include <utility>
 
 namespace py = pybind11;
 
@@ -24,5 +25,33 @@ void present();
 
 Vec2 getResolution();
 
+void setTarget(py::object target);
+
+void pushTarget(SDL_Texture* target);
+
+void popTarget();
+
+// Unbind a target texture that is about to be destroyed
+void _releaseTarget(SDL_Texture* target);
+
+void setRetained(bool retained);
+
+bool isRetained();
+
+void markDirty(py::object rect);
+
+// The size of the texture currently drawn to: the innermost pushed target, or the screen
+Vec2 _viewSize();
+
+// Register the screen-space bounds of a primitive about to be drawn.
+// Returns false when the primitive is outside the current target's view or the dirty
+// region and may be skipped.
+bool _submit(const SDL_FRect& bounds);
+
+std::pair<int, int> getCullStats();
+
+// Force the next present, e.g. after the window contents were lost
+void _invalidateScreen();
+
 SDL_Renderer* get();
 } // namespace renderer
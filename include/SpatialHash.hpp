@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <unordered_map>
+#include <vector>
+
+class Circle;
+class Rect;
+class Vec2;
+
+namespace py = pybind11;
+
+namespace spatial_hash
+{
+void _bind(py::module_& module);
+} // namespace spatial_hash
+
+// A uniform grid broad phase over axis-aligned bounding boxes keyed by integer ids. Boxes live
+// in a dense array, and the grid is a sorted list of (cell, box) references that is rebuilt on
+// the next query whenever a box has moved into different cells
+class SpatialHash
+{
+  public:
+    explicit SpatialHash(double cellSize = 64.0);
+    ~SpatialHash() = default;
+
+    void insert(int64_t id, const Rect& rect);
+
+    void insert(int64_t id, const Circle& circle);
+
+    void move(int64_t id, const Rect& rect);
+
+    void move(int64_t id, const Circle& circle);
+
+    void remove(int64_t id);
+
+    void clear();
+
+    bool contains(int64_t id) const;
+
+    size_t getCount() const;
+
+    double getCellSize() const;
+
+    py::array_t<int64_t> queryRect(const Rect& rect) const;
+
+    py::array_t<int64_t> queryPoint(const Vec2& point) const;
+
+    py::array_t<int64_t> queryCircle(const Circle& circle) const;
+
+    py::array_t<int64_t> queryPairs() const;
+
+  private:
+    struct Box
+    {
+        double minX, minY, maxX, maxY;
+    };
+
+    struct Entry
+    {
+        int64_t id;
+        Box box;
+        int cellX0, cellY0, cellX1, cellY1; // Inclusive range of covered cells
+    };
+
+    struct CellRef
+    {
+        uint64_t key;
+        int slot;
+    };
+
+    double m_cellSize;
+    double m_invCellSize;
+    std::vector<Entry> m_entries;
+    std::unordered_map<int64_t, int> m_slots;
+    mutable std::vector<CellRef> m_cells;
+    mutable bool m_dirty = false;
+
+    int cellOf(double coord) const;
+
+    void add(int64_t id, const Box& box);
+
+    void update(int64_t id, const Box& box);
+
+    void rebuild() const;
+
+    // Call fn(slot) once for every box overlapping the region, inclusive of its edges
+    template <typename Fn>
+    void forEachInBox(const Box& region, Fn&& fn) const;
+};
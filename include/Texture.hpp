@@ -2,8 +2,10 @@
 
 #include <SDL3/SDL.h>
 #include <memory>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <string>
+#include <vector>
 
 struct Color;
 class Rect;
@@ -19,7 +21,7 @@ namespace texture
 void _bind(py::module_& module);
 }
 
-class Texture final
+class Texture
 {
   public:
     double angle = 0.0;
@@ -31,8 +33,10 @@ class Texture final
 
     explicit Texture(SDL_Texture* sdlTexture);
     Texture(const PixelArray& pixelArray);
-    Texture(const std::string& filePath);
-    ~Texture();
+    Texture(const std::string& filePath, bool premultiplied = false);
+    // Levels from largest to smallest, as built by transform.build_mips
+    Texture(const std::vector<std::shared_ptr<PixelArray>>& mips);
+    virtual ~Texture();
 
     void loadFromSDL(SDL_Texture* sdlTexture);
 
@@ -54,14 +58,29 @@ class Texture final
 
     void makeNormal() const;
 
+    bool isPremultiplied() const;
+
+    int getMipLevels() const;
+
     void render(Rect dstRect, py::object srcRect);
 
     void render(py::object pos, Anchor anchor);
 
+    void renderMany(py::array_t<double, py::array::c_style | py::array::forcecast> positions,
+                    py::object srcRects, py::object angles, py::object scales, py::object tints);
+
     std::unique_ptr<Texture> copy();
 
     SDL_Texture* getSDL() const;
 
+    // Render a source region to a world-space destination, batching when a batch is active
+    void _render(const SDL_FRect& srcRect, SDL_FRect dstRect, double angle,
+                 const Flip& flipMode) const;
+
   private:
     SDL_Texture* m_texPtr = nullptr;
+    std::vector<SDL_Texture*> m_mips; // Levels below m_texPtr, each about half the previous size
+    bool m_premultiplied = false;
+
+    void destroyMips();
 };
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Texture.hpp"
+
+class PixelArray;
+class Rect;
+class Vec2;
+enum class Anchor;
+
+namespace py = pybind11;
+
+namespace texture_atlas
+{
+void _bind(py::module_& module);
+} // namespace texture_atlas
+
+class AtlasRegion
+{
+  public:
+    double angle = 0.0;
+    Texture::Flip flip;
+
+    AtlasRegion(std::shared_ptr<Texture> page, const SDL_FRect& srcRect);
+    ~AtlasRegion() = default;
+
+    Vec2 getSize() const;
+
+    Rect getRect() const;
+
+    Rect getSrcRect() const;
+
+    std::shared_ptr<Texture> getTexture() const;
+
+    void render(Rect dstRect, py::object srcRect) const;
+
+    void render(py::object pos, Anchor anchor) const;
+
+  private:
+    std::shared_ptr<Texture> m_page;
+    SDL_FRect m_srcRect;
+};
+
+class TextureAtlas
+{
+  public:
+    explicit TextureAtlas(int pageSize = 2048, int padding = 1, bool premultiplied = false);
+    ~TextureAtlas();
+
+    void add(const std::string& name, const PixelArray& pixelArray);
+
+    void add(const std::string& name, const std::string& filePath);
+
+    void build();
+
+    std::shared_ptr<AtlasRegion> get(const std::string& name) const;
+
+    bool contains(const std::string& name) const;
+
+    size_t getCount() const;
+
+    bool isPremultiplied() const;
+
+    const std::vector<std::shared_ptr<Texture>>& getPages() const;
+
+  private:
+    struct Pending
+    {
+        std::string name;
+        SDL_Surface* surface = nullptr;
+    };
+
+    int m_pageSize;
+    int m_padding;
+    bool m_premultiplied; // Alpha layout of every page; added images are converted to it
+    std::vector<Pending> m_pending;
+    std::vector<std::shared_ptr<Texture>> m_pages;
+    std::unordered_map<std::string, std::shared_ptr<AtlasRegion>> m_regions;
+
+    void queue(const std::string& name, SDL_Surface* surface);
+};
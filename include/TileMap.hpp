@@ -0,0 +1,70 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <memory>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+#include "Math.hpp"
+
+class Texture;
+
+namespace py = pybind11;
+
+namespace tile_map
+{
+void _bind(py::module_& module);
+} // namespace tile_map
+
+class TileMap
+{
+  public:
+    Vec2 pos;
+
+    TileMap(std::shared_ptr<Texture> tileset, const Vec2& tileSize,
+            py::array_t<int32_t, py::array::c_style | py::array::forcecast> tiles,
+            int chunkSize = 16);
+    ~TileMap() = default;
+
+    int getTile(int col, int row) const;
+
+    void setTile(int col, int row, int tileId);
+
+    void setTiles(py::array_t<int32_t, py::array::c_style | py::array::forcecast> tiles);
+
+    py::array_t<int32_t> getTiles() const;
+
+    int getCols() const;
+
+    int getRows() const;
+
+    Vec2 getTileSize() const;
+
+    std::shared_ptr<Texture> getTileset() const;
+
+    void setTileset(std::shared_ptr<Texture> tileset);
+
+    void render();
+
+  private:
+    struct Chunk
+    {
+        std::vector<SDL_Vertex> vertices;
+        bool dirty = true;
+    };
+
+    std::shared_ptr<Texture> m_tileset;
+    float m_tileW, m_tileH;
+    int m_cols = 0;
+    int m_rows = 0;
+    int m_chunkSize;
+    int m_chunkCols = 0;
+    int m_chunkRows = 0;
+    py::array_t<int32_t> m_tiles; // Replaced, never resized, so views of it stay valid
+    std::vector<Chunk> m_chunks;
+
+    void buildChunk(int chunkCol, int chunkRow);
+
+    void markAllDirty();
+};
@@ -1,34 +1,117 @@
 #pragma once
 
 #include <memory>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <vector>
+
+#include "_globals.hpp"
 
 namespace py = pybind11;
 
 class PixelArray;
 class Vec2;
+struct Color;
 
+// Every transform writes into dst (reusing its memory when the size matches), into the input
+// when inplace is true, or otherwise into a new pixel array, and returns the written array
 namespace transform
 {
 void _bind(py::module_& module);
 
-std::unique_ptr<PixelArray> flip(const PixelArray& pixelArray, bool flipX, bool flipY);
+py::object flip(const PixelArray& pixelArray, bool flipX, bool flipY,
+                const py::object& dst = py::none(), bool inplace = false);
+
+py::object scaleTo(const PixelArray& pixelArray, const Vec2& size, bool smooth = false,
+                   const py::object& dst = py::none(), bool inplace = false);
+
+py::object scaleBy(const PixelArray& pixelArray, double factor, bool smooth = false,
+                   const py::object& dst = py::none(), bool inplace = false);
+
+py::object scaleBy(const PixelArray& pixelArray, const Vec2& factor, bool smooth = false,
+                   const py::object& dst = py::none(), bool inplace = false);
+
+// Successive half-size area-averaged levels, from the input itself down to 1x1
+py::list buildMips(const PixelArray& pixelArray);
+
+py::object rotate(const PixelArray& pixelArray, double angle, bool smooth = false,
+                  const py::object& dst = py::none(), bool inplace = false);
+
+py::object rotozoom(const PixelArray& pixelArray, double angle, double scale,
+                    bool smooth = true, const py::object& dst = py::none(),
+                    bool inplace = false);
+
+py::object boxBlur(const PixelArray& pixelArray, int radius, bool repeatEdgePixels = true,
+                   const py::object& dst = py::none(), bool inplace = false);
+
+py::object gaussianBlur(const PixelArray& pixelArray, int radius, bool repeatEdgePixels = true,
+                        BlurQuality quality = BlurQuality::EXACT,
+                        const py::object& dst = py::none(), bool inplace = false);
+
+py::object invert(const PixelArray& pixelArray, const py::object& dst = py::none(),
+                  bool inplace = false);
+
+py::object grayscale(const PixelArray& pixelArray, const py::object& dst = py::none(),
+                     bool inplace = false);
+
+// A chain of operations applied in as few passes over the pixels as possible. Adjacent color
+// operations are folded into one 4x5 matrix, and each run of point operations between blurs is
+// applied in a single pass
+class Pipeline
+{
+  public:
+    struct Stage
+    {
+        enum class Kind
+        {
+            MATRIX,
+            THRESHOLD,
+            BOX_BLUR,
+            GAUSSIAN_BLUR,
+        };
+
+        Kind kind = Kind::MATRIX;
+        float columns[5][4] = {}; // Column-major 4x5 color matrix, bias column in 0-255 units
+        float level = 0.f;
+        int radius = 0;
+        bool repeatEdgePixels = true;
+        BlurQuality quality = BlurQuality::EXACT;
+    };
+
+    Pipeline() = default;
+    ~Pipeline() = default;
+
+    Pipeline& invert();
+
+    Pipeline& grayscale();
+
+    Pipeline& brightness(double amount);
+
+    Pipeline& contrast(double factor);
+
+    Pipeline& colorMatrix(py::array_t<float, py::array::c_style | py::array::forcecast> matrix);
+
+    Pipeline& tint(const Color& color);
+
+    Pipeline& alphaMultiply(double factor);
 
-std::unique_ptr<PixelArray> scaleTo(const PixelArray& pixelArray, const Vec2& size);
+    Pipeline& threshold(int level);
 
-std::unique_ptr<PixelArray> scaleBy(const PixelArray& pixelArray, double factor);
+    Pipeline& boxBlur(int radius, bool repeatEdgePixels = true);
 
-std::unique_ptr<PixelArray> scaleBy(const PixelArray& pixelArray, const Vec2& factor);
+    Pipeline& gaussianBlur(int radius, bool repeatEdgePixels = true,
+                           BlurQuality quality = BlurQuality::EXACT);
 
-std::unique_ptr<PixelArray> rotate(const PixelArray& pixelArray, double angle);
+    void clear();
 
-std::unique_ptr<PixelArray> boxBlur(const PixelArray& pixelArray, int radius,
-                                     bool repeatEdgePixels = true);
+    int getPassCount() const;
 
-std::unique_ptr<PixelArray> gaussianBlur(const PixelArray& pixelArray, int radius,
-                                         bool repeatEdgePixels = true);
+    py::object apply(const PixelArray& pixelArray, const py::object& dst = py::none(),
+                     bool inplace = false) const;
 
-std::unique_ptr<PixelArray> invert(const PixelArray& pixelArray);
+  private:
+    std::vector<Stage> m_stages;
 
-std::unique_ptr<PixelArray> grayscale(const PixelArray& pixelArray);
+    Pipeline& addMatrix(const float matrix[4][5]);
+};
 } // namespace transform
@@ -25,6 +25,12 @@ enum class Anchor
     BOTTOM_RIGHT,
 };
 
+enum class BlurQuality
+{
+    EXACT,
+    FAST,
+};
+
 enum class KnKeycode : SDL_Keycode
 {
     K_BACKSPACE = SDLK_BACKSPACE,
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <functional>
+
+namespace parallel
+{
+// Split [0, count) into chunks of at least minChunk items and run fn(begin, end) for each
+// chunk on a shared worker pool. The calling thread takes part and the call returns once every
+// chunk has finished. Calls made from inside fn run serially on the calling thread. fn must not
+// throw or touch Python objects.
+void forRange(int count, int minChunk, const std::function<void(int, int)>& fn);
+
+// While alive, forRange calls made on this thread run serially instead of on the worker pool.
+// Background threads use it so they never hold the pool while the main thread waits for it
+class SerialScope
+{
+  public:
+    SerialScope();
+    ~SerialScope();
+
+    SerialScope(const SerialScope&) = delete;
+    SerialScope& operator=(const SerialScope&) = delete;
+
+  private:
+    bool m_previous;
+};
+} // namespace parallel
@@ -0,0 +1,11 @@
+#pragma once
+
+// SIMD instruction set selection for the pixel kernels. SSE2 is part of every x86-64 target
+// and NEON of every AArch64 target, so no runtime dispatch is needed for either.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define KN_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+#define KN_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
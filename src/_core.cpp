@@ -1,3 +1,5 @@
+#include "AABBTree.hpp"
+#include "AssetLoader.hpp"
 #include "Camera.hpp"
 #include "Circle.hpp"
 #include "Color.hpp"
@@ -9,14 +11,19 @@
 #include "Input.hpp"
 #include "Key.hpp"
 #include "Line.hpp"
+#include "Mask.hpp"
 #include "Math.hpp"
 #include "Mixer.hpp"
 #include "Mouse.hpp"
 #include "PixelArray.hpp"
 #include "Polygon.hpp"
 #include "Rect.hpp"
+#include "RenderTarget.hpp"
 #include "Renderer.hpp"
+#include "SpatialHash.hpp"
 #include "Texture.hpp"
+#include "TextureAtlas.hpp"
+#include "TileMap.hpp"
 #include "Time.hpp"
 #include "Transform.hpp"
 #include "Window.hpp"
@@ -39,6 +46,10 @@ Call this once you're done using the engine to avoid memory leaks.
     math::_bind(m);
     rect::_bind(m);
     texture::_bind(m);
+    render_target::_bind(m);
+    texture_atlas::_bind(m);
+    asset_loader::_bind(m);
+    tile_map::_bind(m);
     polygon::_bind(m);
 
     camera::_bind(m);
@@ -50,6 +61,9 @@ Call this once you're done using the engine to avoid memory leaks.
     input::_bind(m);
     key::_bind(m);
     line::_bind(m);
+    mask::_bind(m);
+    spatial_hash::_bind(m);
+    aabb_tree::_bind(m);
     mixer::_bind(m);
     mouse::_bind(m);
     renderer::_bind(m);
@@ -0,0 +1,147 @@
+#include "_parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Set while the current thread is running chunks of a pool job
+thread_local bool t_inJob = false;
+
+// Set while a SerialScope is alive on the current thread
+thread_local bool t_serial = false;
+
+class WorkerPool
+{
+  public:
+    explicit WorkerPool(const unsigned workerCount)
+    {
+        for (unsigned i = 0; i < workerCount; ++i)
+            m_workers.emplace_back([this] { workerLoop(); });
+    }
+
+    int getThreadCount() const { return static_cast<int>(m_workers.size()) + 1; }
+
+    void run(const int chunkCount, const std::function<void(int)>& task)
+    {
+        // Only one job runs at a time, so callers on other threads wait their turn. Calls made
+        // from inside a chunk never get here: forRange runs them inline on the calling thread
+        std::lock_guard<std::mutex> runLock(m_runMutex);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_task = &task;
+            m_chunkCount = chunkCount;
+            m_nextChunk.store(0);
+            m_doneChunks = 0;
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        const int done = drain();
+
+        // Wait for the workers to leave the job too, so none can touch it once it is reset
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneChunks += done;
+        m_finished.wait(lock, [this] { return m_doneChunks == m_chunkCount && m_active == 0; });
+        m_task = nullptr;
+    }
+
+  private:
+    std::vector<std::thread> m_workers;
+    std::mutex m_runMutex;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_finished;
+    const std::function<void(int)>* m_task = nullptr;
+    int m_chunkCount = 0;
+    int m_doneChunks = 0;
+    int m_active = 0;
+    unsigned m_generation = 0;
+    std::atomic<int> m_nextChunk{0};
+
+    int drain()
+    {
+        t_inJob = true;
+        int done = 0;
+        for (int chunk = m_nextChunk.fetch_add(1); chunk < m_chunkCount;
+             chunk = m_nextChunk.fetch_add(1))
+        {
+            (*m_task)(chunk);
+            ++done;
+        }
+        t_inJob = false;
+        return done;
+    }
+
+    void workerLoop()
+    {
+        unsigned seen = 0;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [&] { return m_generation != seen; });
+                seen = m_generation;
+                if (!m_task)
+                    continue;
+                ++m_active;
+            }
+
+            const int done = drain();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_doneChunks += done;
+            --m_active;
+            if (m_doneChunks == m_chunkCount && m_active == 0)
+                m_finished.notify_one();
+        }
+    }
+};
+
+WorkerPool& _pool()
+{
+    // Intentionally leaked: the workers sleep forever once idle and joining them while the
+    // interpreter unloads the module can deadlock on some platforms.
+    static WorkerPool* pool =
+        new WorkerPool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return *pool;
+}
+} // namespace
+
+namespace parallel
+{
+void forRange(const int count, const int minChunk, const std::function<void(int, int)>& fn)
+{
+    if (count <= 0)
+        return;
+
+    WorkerPool& pool = _pool();
+    const int maxChunks = (count + std::max(minChunk, 1) - 1) / std::max(minChunk, 1);
+    const int chunkCount = std::min(maxChunks, pool.getThreadCount() * 4);
+    // A nested call would wait on the job it is part of, so it runs on this thread instead
+    if (chunkCount <= 1 || t_inJob || t_serial)
+    {
+        fn(0, count);
+        return;
+    }
+
+    const int chunkSize = (count + chunkCount - 1) / chunkCount;
+    const std::function<void(int)> task = [&](const int chunk)
+    {
+        const int begin = chunk * chunkSize;
+        const int end = std::min(begin + chunkSize, count);
+        if (begin < end)
+            fn(begin, end);
+    };
+    pool.run(chunkCount, task);
+}
+
+SerialScope::SerialScope() : m_previous(t_serial) { t_serial = true; }
+
+SerialScope::~SerialScope() { t_serial = m_previous; }
+} // namespace parallel
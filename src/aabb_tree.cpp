@@ -0,0 +1,754 @@
+#include "AABBTree.hpp"
+#include "Circle.hpp"
+#include "Line.hpp"
+#include "Math.hpp"
+#include "Rect.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+static AABBTree::Box _rectBox(const Rect& rect);
+static AABBTree::Box _circleBox(const Circle& circle);
+static AABBTree::Box _union(const AABBTree::Box& a, const AABBTree::Box& b);
+static AABBTree::Box _expand(const AABBTree::Box& box, double amount);
+static bool _containsBox(const AABBTree::Box& outer, const AABBTree::Box& inner);
+static double _perimeter(const AABBTree::Box& box);
+static double _distanceSquared(const AABBTree::Box& box, double x, double y);
+static bool _segmentHits(const AABBTree::Box& box, double ox, double oy, double dx, double dy,
+                         double& tEnter);
+static py::array_t<int64_t> _toArray(const std::vector<int64_t>& ids);
+
+namespace aabb_tree
+{
+void _bind(py::module_& module)
+{
+    py::classh<AABBTree>(module, "AABBTree", R"doc(
+A bounding volume hierarchy for finding shapes near a region or along a line.
+
+Each shape is stored by integer id as its axis-aligned bounding box. Unlike SpatialHash,
+the tree adapts to shapes of very different sizes and to sparse worlds, which makes it a
+good fit for level geometry and line-of-sight checks.
+
+Stored boxes are enlarged by a margin, so shapes that move a little do not change the
+tree. After building a static world with many inserts, call rebuild() once for faster
+queries.
+    )doc")
+        .def(py::init<double>(), py::arg("margin") = 4.0, R"doc(
+Create an empty tree.
+
+Args:
+    margin (float, optional): How far stored boxes are enlarged on each side. Larger
+                              margins make moves cheaper and queries slower. Defaults to 4.
+
+Raises:
+    ValueError: If margin is negative.
+        )doc")
+
+        .def_property_readonly("margin", &AABBTree::getMargin, R"doc(
+How far stored boxes are enlarged on each side.
+        )doc")
+        .def_property_readonly("height", &AABBTree::getHeight, R"doc(
+The number of levels in the tree, or 0 if it is empty.
+        )doc")
+
+        .def("insert", py::overload_cast<int64_t, const Rect&>(&AABBTree::insert),
+             py::arg("id"), py::arg("rect"), R"doc(
+Add a rectangle.
+
+Args:
+    id (int): The id to store the rectangle under.
+    rect (Rect): The rectangle's bounds.
+
+Raises:
+    ValueError: If the id is already in the tree.
+        )doc")
+        .def("insert", py::overload_cast<int64_t, const Circle&>(&AABBTree::insert),
+             py::arg("id"), py::arg("circle"), R"doc(
+Add a circle, stored as its bounding box.
+
+Args:
+    id (int): The id to store the circle under.
+    circle (Circle): The circle.
+
+Raises:
+    ValueError: If the id is already in the tree.
+        )doc")
+        .def("move", py::overload_cast<int64_t, const Rect&>(&AABBTree::move),
+             py::arg("id"), py::arg("rect"), R"doc(
+Update the bounds stored under an id.
+
+Args:
+    id (int): The id of the shape to move.
+    rect (Rect): The new bounds.
+
+Raises:
+    KeyError: If the id is not in the tree.
+        )doc")
+        .def("move", py::overload_cast<int64_t, const Circle&>(&AABBTree::move),
+             py::arg("id"), py::arg("circle"), R"doc(
+Update the bounds stored under an id to those of a circle.
+
+Args:
+    id (int): The id of the shape to move.
+    circle (Circle): The new circle.
+
+Raises:
+    KeyError: If the id is not in the tree.
+        )doc")
+        .def("remove", &AABBTree::remove, py::arg("id"), R"doc(
+Remove the shape stored under an id.
+
+Args:
+    id (int): The id of the shape to remove.
+
+Raises:
+    KeyError: If the id is not in the tree.
+        )doc")
+        .def("clear", &AABBTree::clear, R"doc(
+Remove every shape.
+        )doc")
+        .def("rebuild", &AABBTree::rebuild, R"doc(
+Rebuild the whole tree from its current shapes for the fastest queries.
+
+Inserting shapes one at a time keeps the tree balanced but not optimal. This is worth
+calling once after loading a level, not every frame.
+        )doc")
+
+        .def("query_rect", &AABBTree::queryRect, py::arg("rect"), R"doc(
+Find the shapes whose bounds overlap a rectangle.
+
+Args:
+    rect (Rect): The region to search.
+
+Returns:
+    numpy.ndarray: Array with shape (N,) of the matching ids.
+        )doc")
+        .def("query_point", &AABBTree::queryPoint, py::arg("point"), R"doc(
+Find the shapes whose bounds contain a point, including their edges.
+
+Args:
+    point (Vec2): The point to test.
+
+Returns:
+    numpy.ndarray: Array with shape (N,) of the matching ids.
+        )doc")
+        .def("query_circle", &AABBTree::queryCircle, py::arg("circle"), R"doc(
+Find the shapes whose bounds touch a circle.
+
+Args:
+    circle (Circle): The region to search.
+
+Returns:
+    numpy.ndarray: Array with shape (N,) of the matching ids.
+        )doc")
+        .def("raycast", &AABBTree::raycast, py::arg("line"), R"doc(
+Find the shapes whose bounds the line segment from a to b touches.
+
+Args:
+    line (Line): The segment to cast.
+
+Returns:
+    numpy.ndarray: Array with shape (N,) of the hit ids, nearest to point a first.
+        )doc")
+
+        .def("__len__", &AABBTree::getCount)
+        .def("__contains__", &AABBTree::contains, py::arg("id"));
+}
+} // namespace aabb_tree
+
+AABBTree::AABBTree(const double margin) : m_margin(margin)
+{
+    if (!(margin >= 0.0))
+        throw std::invalid_argument("Margin cannot be negative");
+}
+
+void AABBTree::insert(const int64_t id, const Rect& rect) { add(id, _rectBox(rect)); }
+
+void AABBTree::insert(const int64_t id, const Circle& circle) { add(id, _circleBox(circle)); }
+
+void AABBTree::move(const int64_t id, const Rect& rect) { update(id, _rectBox(rect)); }
+
+void AABBTree::move(const int64_t id, const Circle& circle) { update(id, _circleBox(circle)); }
+
+void AABBTree::remove(const int64_t id)
+{
+    const auto it = m_leaves.find(id);
+    if (it == m_leaves.end())
+        throw py::key_error("No shape with id " + std::to_string(id));
+
+    removeLeaf(it->second);
+    freeNode(it->second);
+    m_leaves.erase(it);
+}
+
+void AABBTree::clear()
+{
+    m_nodes.clear();
+    m_leaves.clear();
+    m_root = -1;
+    m_free = -1;
+}
+
+void AABBTree::rebuild()
+{
+    if (m_root == -1)
+        return;
+
+    // Return the internal nodes to the pool; leaves keep their indices so ids stay valid
+    std::vector<int> leaves;
+    leaves.reserve(m_leaves.size());
+    std::vector<int> stack = {m_root};
+    while (!stack.empty())
+    {
+        const int index = stack.back();
+        stack.pop_back();
+        if (m_nodes[index].left == -1)
+        {
+            leaves.push_back(index);
+            continue;
+        }
+        stack.push_back(m_nodes[index].left);
+        stack.push_back(m_nodes[index].right);
+        freeNode(index);
+    }
+
+    m_root = build(leaves.data(), static_cast<int>(leaves.size()), 0);
+    m_nodes[m_root].parent = -1;
+}
+
+bool AABBTree::contains(const int64_t id) const { return m_leaves.count(id) > 0; }
+
+size_t AABBTree::getCount() const { return m_leaves.size(); }
+
+double AABBTree::getMargin() const { return m_margin; }
+
+int AABBTree::getHeight() const { return m_root == -1 ? 0 : m_nodes[m_root].height + 1; }
+
+py::array_t<int64_t> AABBTree::queryRect(const Rect& rect) const
+{
+    const Box region = _rectBox(rect);
+
+    std::vector<int64_t> ids;
+    traverse(
+        [&region](const Box& box)
+        {
+            return box.minX <= region.maxX && box.maxX >= region.minX &&
+                   box.minY <= region.maxY && box.maxY >= region.minY;
+        },
+        [&](const int leaf)
+        {
+            const Box& box = m_nodes[leaf].tight;
+            if (box.minX < region.maxX && box.maxX > region.minX && box.minY < region.maxY &&
+                box.maxY > region.minY)
+                ids.push_back(m_nodes[leaf].id);
+        });
+    return _toArray(ids);
+}
+
+py::array_t<int64_t> AABBTree::queryPoint(const Vec2& point) const
+{
+    const auto touches = [&point](const Box& box)
+    {
+        return box.minX <= point.x && point.x <= box.maxX && box.minY <= point.y &&
+               point.y <= box.maxY;
+    };
+
+    std::vector<int64_t> ids;
+    traverse(touches,
+             [&](const int leaf)
+             {
+                 if (touches(m_nodes[leaf].tight))
+                     ids.push_back(m_nodes[leaf].id);
+             });
+    return _toArray(ids);
+}
+
+py::array_t<int64_t> AABBTree::queryCircle(const Circle& circle) const
+{
+    const double x = circle.pos.x;
+    const double y = circle.pos.y;
+    const double radiusSquared = circle.radius * circle.radius;
+    const auto touches = [=](const Box& box)
+    { return _distanceSquared(box, x, y) <= radiusSquared; };
+
+    std::vector<int64_t> ids;
+    traverse(touches,
+             [&](const int leaf)
+             {
+                 if (touches(m_nodes[leaf].tight))
+                     ids.push_back(m_nodes[leaf].id);
+             });
+    return _toArray(ids);
+}
+
+py::array_t<int64_t> AABBTree::raycast(const Line& line) const
+{
+    const double dx = line.bx - line.ax;
+    const double dy = line.by - line.ay;
+
+    std::vector<std::pair<double, int64_t>> hits;
+    traverse(
+        [&](const Box& box)
+        {
+            double tEnter;
+            return _segmentHits(box, line.ax, line.ay, dx, dy, tEnter);
+        },
+        [&](const int leaf)
+        {
+            double tEnter;
+            if (_segmentHits(m_nodes[leaf].tight, line.ax, line.ay, dx, dy, tEnter))
+                hits.emplace_back(tEnter, m_nodes[leaf].id);
+        });
+
+    std::sort(hits.begin(), hits.end());
+    std::vector<int64_t> ids(hits.size());
+    for (size_t i = 0; i < hits.size(); ++i)
+        ids[i] = hits[i].second;
+    return _toArray(ids);
+}
+
+int AABBTree::allocateNode()
+{
+    if (m_free == -1)
+    {
+        m_nodes.push_back({});
+        m_free = static_cast<int>(m_nodes.size()) - 1;
+        m_nodes[m_free].right = -1;
+    }
+
+    const int index = m_free;
+    Node& node = m_nodes[index];
+    m_free = node.right;
+    node.parent = -1;
+    node.left = -1;
+    node.right = -1;
+    node.height = 0;
+    node.id = 0;
+    return index;
+}
+
+void AABBTree::freeNode(const int index)
+{
+    m_nodes[index].right = m_free;
+    m_nodes[index].height = -1;
+    m_free = index;
+}
+
+void AABBTree::add(const int64_t id, const Box& box)
+{
+    if (m_leaves.count(id))
+        throw std::invalid_argument("A shape with id " + std::to_string(id) + " already exists");
+
+    const int leaf = allocateNode();
+    Node& node = m_nodes[leaf];
+    node.box = _expand(box, m_margin);
+    node.tight = box;
+    node.id = id;
+    m_leaves.emplace(id, leaf);
+    insertLeaf(leaf);
+}
+
+void AABBTree::update(const int64_t id, const Box& box)
+{
+    const auto it = m_leaves.find(id);
+    if (it == m_leaves.end())
+        throw py::key_error("No shape with id " + std::to_string(id));
+
+    const int leaf = it->second;
+    m_nodes[leaf].tight = box;
+
+    // Keep the stored box while it still holds the shape, unless the shape has shrunk so much
+    // that the stored box would make queries visit it needlessly
+    const Box fat = _expand(box, m_margin);
+    if (_containsBox(m_nodes[leaf].box, box) &&
+        _containsBox(_expand(box, 4.0 * m_margin), m_nodes[leaf].box))
+        return;
+
+    removeLeaf(leaf);
+    m_nodes[leaf].box = fat;
+    insertLeaf(leaf);
+}
+
+void AABBTree::insertLeaf(const int leaf)
+{
+    if (m_root == -1)
+    {
+        m_root = leaf;
+        m_nodes[leaf].parent = -1;
+        return;
+    }
+
+    // Walk down towards the sibling that adds the least perimeter to the tree. Every ancestor
+    // of the new parent grows by the same amount, which is charged as the inherited cost
+    const Box leafBox = m_nodes[leaf].box;
+    int index = m_root;
+    while (m_nodes[index].left != -1)
+    {
+        const Node& node = m_nodes[index];
+        const double perimeter = _perimeter(node.box);
+        const double combined = _perimeter(_union(node.box, leafBox));
+        const double cost = 2.0 * combined;
+        const double inherited = 2.0 * (combined - perimeter);
+
+        const auto descendCost = [&](const int child)
+        {
+            const Box& childBox = m_nodes[child].box;
+            const double grown = _perimeter(_union(childBox, leafBox));
+            if (m_nodes[child].left == -1)
+                return grown + inherited;
+            return grown - _perimeter(childBox) + inherited;
+        };
+        const double leftCost = descendCost(node.left);
+        const double rightCost = descendCost(node.right);
+
+        if (cost < leftCost && cost < rightCost)
+            break;
+        index = leftCost < rightCost ? node.left : node.right;
+    }
+
+    const int sibling = index;
+    const int oldParent = m_nodes[sibling].parent;
+    const int newParent = allocateNode();
+
+    Node& parent = m_nodes[newParent];
+    parent.parent = oldParent;
+    parent.box = _union(leafBox, m_nodes[sibling].box);
+    parent.height = m_nodes[sibling].height + 1;
+    parent.left = sibling;
+    parent.right = leaf;
+
+    if (oldParent == -1)
+        m_root = newParent;
+    else if (m_nodes[oldParent].left == sibling)
+        m_nodes[oldParent].left = newParent;
+    else
+        m_nodes[oldParent].right = newParent;
+
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+    refit(newParent);
+}
+
+void AABBTree::removeLeaf(const int leaf)
+{
+    if (leaf == m_root)
+    {
+        m_root = -1;
+        return;
+    }
+
+    const int parent = m_nodes[leaf].parent;
+    const int grandParent = m_nodes[parent].parent;
+    const int sibling =
+        m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+
+    m_nodes[sibling].parent = grandParent;
+    freeNode(parent);
+
+    if (grandParent == -1)
+    {
+        m_root = sibling;
+        return;
+    }
+
+    if (m_nodes[grandParent].left == parent)
+        m_nodes[grandParent].left = sibling;
+    else
+        m_nodes[grandParent].right = sibling;
+    refit(grandParent);
+}
+
+void AABBTree::refit(int index)
+{
+    while (index != -1)
+    {
+        index = balance(index);
+
+        Node& node = m_nodes[index];
+        const Node& left = m_nodes[node.left];
+        const Node& right = m_nodes[node.right];
+        node.height = 1 + std::max(left.height, right.height);
+        node.box = _union(left.box, right.box);
+        index = node.parent;
+    }
+}
+
+int AABBTree::balance(const int indexA)
+{
+    // Rotate the taller grandchild up when the subtrees of A differ in height by more than
+    // one. Returns the node now at A's position
+    Node& a = m_nodes[indexA];
+    if (a.left == -1 || a.height < 2)
+        return indexA;
+
+    const int indexB = a.left;
+    const int indexC = a.right;
+    Node& b = m_nodes[indexB];
+    Node& c = m_nodes[indexC];
+    const int heightDiff = c.height - b.height;
+
+    if (heightDiff > 1 || heightDiff < -1)
+    {
+        // Name the taller child "up" and its children F and G, then mirror the layout
+        const bool rightHeavy = heightDiff > 1;
+        const int indexUp = rightHeavy ? indexC : indexB;
+        const int indexOther = rightHeavy ? indexB : indexC;
+        Node& up = m_nodes[indexUp];
+        const int indexF = up.left;
+        const int indexG = up.right;
+        Node& f = m_nodes[indexF];
+        Node& g = m_nodes[indexG];
+
+        up.left = indexA;
+        up.parent = a.parent;
+        a.parent = indexUp;
+
+        if (up.parent == -1)
+            m_root = indexUp;
+        else if (m_nodes[up.parent].left == indexA)
+            m_nodes[up.parent].left = indexUp;
+        else
+            m_nodes[up.parent].right = indexUp;
+
+        // The shorter grandchild moves under A in place of "up"
+        const bool keepF = f.height > g.height;
+        const int indexKept = keepF ? indexF : indexG;
+        const int indexMoved = keepF ? indexG : indexF;
+        up.right = indexKept;
+        if (rightHeavy)
+            a.right = indexMoved;
+        else
+            a.left = indexMoved;
+        m_nodes[indexMoved].parent = indexA;
+
+        const Node& other = m_nodes[indexOther];
+        const Node& moved = m_nodes[indexMoved];
+        const Node& kept = m_nodes[indexKept];
+        a.box = _union(other.box, moved.box);
+        a.height = 1 + std::max(other.height, moved.height);
+        up.box = _union(a.box, kept.box);
+        up.height = 1 + std::max(a.height, kept.height);
+        return indexUp;
+    }
+
+    return indexA;
+}
+
+int AABBTree::build(int* leaves, const int count, const int depth)
+{
+    if (count == 1)
+        return leaves[0];
+
+    const auto centerX = [this](const int leaf)
+    { return m_nodes[leaf].box.minX + m_nodes[leaf].box.maxX; };
+    const auto centerY = [this](const int leaf)
+    { return m_nodes[leaf].box.minY + m_nodes[leaf].box.maxY; };
+
+    double minX = std::numeric_limits<double>::infinity();
+    double minY = minX;
+    double maxX = -minX;
+    double maxY = -minX;
+    for (int i = 0; i < count; ++i)
+    {
+        minX = std::min(minX, centerX(leaves[i]));
+        maxX = std::max(maxX, centerX(leaves[i]));
+        minY = std::min(minY, centerY(leaves[i]));
+        maxY = std::max(maxY, centerY(leaves[i]));
+    }
+
+    // Split across the wider spread of box centers
+    const bool splitX = maxX - minX >= maxY - minY;
+    const auto center = [&](const int leaf) { return splitX ? centerX(leaf) : centerY(leaf); };
+    const double low = splitX ? minX : minY;
+    const double extent = splitX ? maxX - minX : maxY - minY;
+
+    int mid = count / 2;
+    if (extent > 0.0 && depth < 48)
+    {
+        // Bin the centers and pick the bin boundary with the lowest surface area heuristic
+        // cost, perimeter times shape count summed over both sides
+        constexpr int BIN_COUNT = 16;
+        const double scale = BIN_COUNT / extent;
+        const auto binOf = [&](const int leaf)
+        { return std::min(BIN_COUNT - 1, static_cast<int>((center(leaf) - low) * scale)); };
+
+        int binCounts[BIN_COUNT] = {};
+        Box binBoxes[BIN_COUNT];
+        for (int i = 0; i < count; ++i)
+        {
+            const int bin = binOf(leaves[i]);
+            const Box& box = m_nodes[leaves[i]].box;
+            binBoxes[bin] = binCounts[bin]++ ? _union(binBoxes[bin], box) : box;
+        }
+
+        double rightCosts[BIN_COUNT] = {};
+        Box accumulated = {};
+        int accumulatedCount = 0;
+        for (int bin = BIN_COUNT - 1; bin > 0; --bin)
+        {
+            if (binCounts[bin])
+            {
+                accumulated =
+                    accumulatedCount ? _union(accumulated, binBoxes[bin]) : binBoxes[bin];
+                accumulatedCount += binCounts[bin];
+            }
+            rightCosts[bin] = accumulatedCount ? _perimeter(accumulated) * accumulatedCount : 0.0;
+        }
+
+        int bestSplit = 0;
+        double bestCost = std::numeric_limits<double>::infinity();
+        accumulatedCount = 0;
+        for (int bin = 0; bin < BIN_COUNT - 1; ++bin)
+        {
+            if (binCounts[bin])
+            {
+                accumulated =
+                    accumulatedCount ? _union(accumulated, binBoxes[bin]) : binBoxes[bin];
+                accumulatedCount += binCounts[bin];
+            }
+            if (accumulatedCount == 0 || accumulatedCount == count)
+                continue;
+
+            const double cost = _perimeter(accumulated) * accumulatedCount + rightCosts[bin + 1];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestSplit = bin + 1;
+            }
+        }
+
+        if (bestSplit > 0)
+            mid = static_cast<int>(std::partition(leaves, leaves + count, [&](const int leaf)
+                                                  { return binOf(leaf) < bestSplit; }) -
+                                   leaves);
+    }
+    else
+    {
+        // All centers coincide, or the tree is already deep, so halve the shapes instead
+        std::nth_element(leaves, leaves + mid, leaves + count,
+                         [&](const int a, const int b) { return center(a) < center(b); });
+    }
+
+    const int left = build(leaves, mid, depth + 1);
+    const int right = build(leaves + mid, count - mid, depth + 1);
+
+    const int index = allocateNode();
+    Node& node = m_nodes[index];
+    node.left = left;
+    node.right = right;
+    node.box = _union(m_nodes[left].box, m_nodes[right].box);
+    node.height = 1 + std::max(m_nodes[left].height, m_nodes[right].height);
+    m_nodes[left].parent = index;
+    m_nodes[right].parent = index;
+    return index;
+}
+
+template <typename Test, typename Fn>
+void AABBTree::traverse(Test&& test, Fn&& fn) const
+{
+    if (m_root == -1)
+        return;
+
+    std::vector<int> stack;
+    stack.reserve(64);
+    stack.push_back(m_root);
+    while (!stack.empty())
+    {
+        const Node& node = m_nodes[stack.back()];
+        const int index = stack.back();
+        stack.pop_back();
+        if (!test(node.box))
+            continue;
+
+        if (node.left == -1)
+        {
+            fn(index);
+            continue;
+        }
+        stack.push_back(node.right);
+        stack.push_back(node.left);
+    }
+}
+
+AABBTree::Box _rectBox(const Rect& rect)
+{
+    return {std::min(rect.x, rect.x + rect.w), std::min(rect.y, rect.y + rect.h),
+            std::max(rect.x, rect.x + rect.w), std::max(rect.y, rect.y + rect.h)};
+}
+
+AABBTree::Box _circleBox(const Circle& circle)
+{
+    const double radius = std::abs(circle.radius);
+    return {circle.pos.x - radius, circle.pos.y - radius, circle.pos.x + radius,
+            circle.pos.y + radius};
+}
+
+AABBTree::Box _union(const AABBTree::Box& a, const AABBTree::Box& b)
+{
+    return {std::min(a.minX, b.minX), std::min(a.minY, b.minY), std::max(a.maxX, b.maxX),
+            std::max(a.maxY, b.maxY)};
+}
+
+AABBTree::Box _expand(const AABBTree::Box& box, const double amount)
+{
+    return {box.minX - amount, box.minY - amount, box.maxX + amount, box.maxY + amount};
+}
+
+bool _containsBox(const AABBTree::Box& outer, const AABBTree::Box& inner)
+{
+    return outer.minX <= inner.minX && outer.minY <= inner.minY && inner.maxX <= outer.maxX &&
+           inner.maxY <= outer.maxY;
+}
+
+double _perimeter(const AABBTree::Box& box)
+{
+    return 2.0 * ((box.maxX - box.minX) + (box.maxY - box.minY));
+}
+
+double _distanceSquared(const AABBTree::Box& box, const double x, const double y)
+{
+    const double dx = x - std::clamp(x, box.minX, box.maxX);
+    const double dy = y - std::clamp(y, box.minY, box.maxY);
+    return dx * dx + dy * dy;
+}
+
+// Slab test of the segment origin + t * direction for t in [0, 1]. Touching an edge counts
+// as a hit, and tEnter is where the segment first reaches the box
+bool _segmentHits(const AABBTree::Box& box, const double ox, const double oy, const double dx,
+                  const double dy, double& tEnter)
+{
+    double t0 = 0.0;
+    double t1 = 1.0;
+
+    const auto clipAxis = [&](const double origin, const double direction, const double min,
+                              const double max)
+    {
+        if (direction == 0.0)
+            return min <= origin && origin <= max;
+
+        const double inverse = 1.0 / direction;
+        double near = (min - origin) * inverse;
+        double far = (max - origin) * inverse;
+        if (near > far)
+            std::swap(near, far);
+        t0 = std::max(t0, near);
+        t1 = std::min(t1, far);
+        return t0 <= t1;
+    };
+
+    if (!clipAxis(ox, dx, box.minX, box.maxX) || !clipAxis(oy, dy, box.minY, box.maxY))
+        return false;
+
+    tEnter = t0;
+    return true;
+}
+
+py::array_t<int64_t> _toArray(const std::vector<int64_t>& ids)
+{
+    py::array_t<int64_t> result(static_cast<py::ssize_t>(ids.size()));
+    std::copy(ids.begin(), ids.end(), result.mutable_data());
+    return result;
+}
@@ -0,0 +1,373 @@
+#include "AssetLoader.hpp"
+#include "PixelArray.hpp"
+#include "Texture.hpp"
+#include "_parallel.hpp"
+
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace asset_loader
+{
+void _bind(py::module_& module)
+{
+    py::classh<AssetHandle>(module, "AssetHandle", R"doc(
+The pending result of an AssetLoader request.
+
+The image is decoded on a loader thread. Texture requests are then uploaded to the GPU
+by AssetLoader.update(), or immediately by get() if they are needed sooner.
+    )doc")
+        .def_property_readonly("path", &AssetHandle::getPath, R"doc(
+The path of the requested image file.
+        )doc")
+        .def_property_readonly("done", &AssetHandle::isDone, R"doc(
+Whether the asset has finished loading, successfully or not.
+        )doc")
+        .def_property_readonly("failed", &AssetHandle::isFailed, R"doc(
+Whether the asset failed to load.
+        )doc")
+        .def_property_readonly("error", &AssetHandle::getError, R"doc(
+The reason the asset failed to load, or an empty string.
+        )doc")
+        .def("get", &AssetHandle::get, R"doc(
+Get the loaded asset, waiting for it if necessary.
+
+Waiting releases the GIL so other Python threads keep running. A texture that is
+decoded but not yet uploaded is uploaded right away, so call this from the main thread.
+
+Returns:
+    Texture | PixelArray: The loaded asset.
+
+Raises:
+    RuntimeError: If the asset failed to load.
+        )doc");
+
+    py::classh<AssetLoader>(module, "AssetLoader", R"doc(
+Loads images in the background so that loading does not stall the game.
+
+Image files are read and decoded by a pool of loader threads. Pixel arrays are ready as
+soon as they are decoded. Textures must be uploaded on the main thread, which update()
+does within a time budget each frame.
+    )doc")
+        .def(py::init<int>(), py::arg("threads") = 0, R"doc(
+Create an asset loader and start its threads.
+
+Args:
+    threads (int, optional): The number of loader threads. Defaults to 0, which picks one
+                             based on the number of CPU cores.
+
+Raises:
+    ValueError: If threads is negative.
+        )doc")
+        .def("load_texture", &AssetLoader::loadTexture, py::arg("file_path"),
+             py::arg("premultiplied") = false, R"doc(
+Request a texture to be loaded in the background.
+
+Args:
+    file_path (str): Path to the image file to load.
+    premultiplied (bool, optional): Whether to premultiply the color channels by alpha and
+                                    blend accordingly. Defaults to False.
+
+Returns:
+    AssetHandle: A handle that yields the Texture once it is loaded.
+
+Raises:
+    ValueError: If file_path is empty.
+        )doc")
+        .def("load_pixel_array", &AssetLoader::loadPixelArray, py::arg("file_path"),
+             py::arg("premultiplied") = false, R"doc(
+Request a pixel array to be loaded in the background.
+
+Args:
+    file_path (str): Path to the image file to load.
+    premultiplied (bool, optional): Whether to premultiply the color channels by alpha.
+                                    Defaults to False.
+
+Returns:
+    AssetHandle: A handle that yields the PixelArray once it is loaded.
+
+Raises:
+    ValueError: If file_path is empty.
+        )doc")
+        .def("update", &AssetLoader::update, py::arg("budget_ms") = 2.0, R"doc(
+Upload decoded textures to the GPU, stopping once the time budget is spent.
+
+Call this once per frame from the main thread. At least one waiting texture is uploaded
+per call, so loading always makes progress.
+
+Args:
+    budget_ms (float, optional): The time to spend uploading, in milliseconds.
+                                 Defaults to 2.0.
+
+Returns:
+    int: The number of textures uploaded.
+        )doc")
+        .def_property_readonly("pending", &AssetLoader::getPendingCount, R"doc(
+The number of requests that are still being decoded or waiting to be uploaded.
+        )doc");
+}
+} // namespace asset_loader
+
+AssetHandle::AssetHandle(std::string filePath, const Kind kind, const bool premultiplied)
+    : m_path(std::move(filePath)), m_kind(kind), m_premultiplied(premultiplied)
+{
+}
+
+const std::string& AssetHandle::getPath() const { return m_path; }
+
+AssetHandle::Kind AssetHandle::getKind() const { return m_kind; }
+
+bool AssetHandle::isDone() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_status == Status::READY || m_status == Status::FAILED;
+}
+
+bool AssetHandle::isFailed() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_status == Status::FAILED;
+}
+
+std::string AssetHandle::getError() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_error;
+}
+
+py::object AssetHandle::get()
+{
+    {
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_decoded.wait(lock, [this] { return m_status != Status::PENDING; });
+    }
+
+    _upload();
+
+    std::shared_ptr<PixelArray> pixelArray;
+    std::shared_ptr<Texture> texture;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_status == Status::FAILED)
+            throw std::runtime_error(m_error);
+        pixelArray = m_pixelArray;
+        texture = m_texture;
+    }
+
+    if (m_kind == Kind::TEXTURE)
+        return py::cast(texture);
+    return py::cast(pixelArray);
+}
+
+void AssetHandle::_decode()
+{
+    std::shared_ptr<PixelArray> pixelArray;
+    std::string error;
+    try
+    {
+        pixelArray = std::make_shared<PixelArray>(m_path, m_premultiplied);
+    }
+    catch (const std::exception& e)
+    {
+        error = e.what();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (pixelArray)
+        {
+            m_pixelArray = std::move(pixelArray);
+            m_status = m_kind == Kind::TEXTURE ? Status::DECODED : Status::READY;
+        }
+        else
+        {
+            m_error = std::move(error);
+            m_status = Status::FAILED;
+        }
+    }
+    m_decoded.notify_all();
+}
+
+bool AssetHandle::_upload()
+{
+    std::shared_ptr<PixelArray> pixelArray;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_status != Status::DECODED)
+            return false;
+        pixelArray = std::move(m_pixelArray);
+    }
+
+    // The decoded pixels are dropped once they are on the GPU
+    std::shared_ptr<Texture> texture;
+    std::string error;
+    try
+    {
+        texture = std::make_shared<Texture>(*pixelArray);
+    }
+    catch (const std::exception& e)
+    {
+        error = e.what();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (texture)
+    {
+        m_texture = std::move(texture);
+        m_status = Status::READY;
+    }
+    else
+    {
+        m_error = std::move(error);
+        m_status = Status::FAILED;
+    }
+    return true;
+}
+
+bool AssetHandle::_isAwaitingUpload() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_status == Status::DECODED;
+}
+
+void AssetHandle::_cancel(const std::string& reason)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_status != Status::PENDING)
+            return;
+        m_error = reason;
+        m_status = Status::FAILED;
+    }
+    m_decoded.notify_all();
+}
+
+AssetLoader::AssetLoader(const int threads)
+{
+    if (threads < 0)
+        throw std::invalid_argument("Thread count cannot be negative");
+
+    // Leave most cores to the game and the pixel kernel worker pool
+    const unsigned count =
+        threads > 0 ? static_cast<unsigned>(threads)
+                    : std::max(1u, std::min(4u, std::thread::hardware_concurrency() / 2));
+    for (unsigned i = 0; i < count; ++i)
+        m_workers.emplace_back([this] { workerLoop(); });
+}
+
+AssetLoader::~AssetLoader()
+{
+    std::deque<std::shared_ptr<AssetHandle>> abandoned;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+        abandoned.swap(m_queue);
+    }
+    m_wake.notify_all();
+
+    for (std::thread& worker : m_workers)
+        worker.join();
+
+    // Decoded textures can still be uploaded through their handles
+    for (const auto& handle : abandoned)
+        handle->_cancel("Asset loader was destroyed before '" + handle->getPath() +
+                        "' was loaded");
+}
+
+std::shared_ptr<AssetHandle> AssetLoader::loadTexture(const std::string& filePath,
+                                                      const bool premultiplied)
+{
+    return enqueue(filePath, AssetHandle::Kind::TEXTURE, premultiplied);
+}
+
+std::shared_ptr<AssetHandle> AssetLoader::loadPixelArray(const std::string& filePath,
+                                                         const bool premultiplied)
+{
+    return enqueue(filePath, AssetHandle::Kind::PIXEL_ARRAY, premultiplied);
+}
+
+int AssetLoader::update(const double budgetMs)
+{
+    const Uint64 start = SDL_GetTicksNS();
+    const auto budget = static_cast<Uint64>(std::max(budgetMs, 0.0) * 1e6);
+
+    int uploaded = 0;
+    for (;;)
+    {
+        std::shared_ptr<AssetHandle> handle;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_uploads.empty())
+                break;
+            handle = std::move(m_uploads.front());
+            m_uploads.pop_front();
+        }
+
+        // Handles already fetched with get() have nothing left to upload
+        if (!handle->_upload())
+            continue;
+
+        ++uploaded;
+        if (SDL_GetTicksNS() - start >= budget)
+            break;
+    }
+    return uploaded;
+}
+
+int AssetLoader::getPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Textures already uploaded by get() stay queued until update() drops them
+    const auto waiting = std::count_if(m_uploads.begin(), m_uploads.end(),
+                                       [](const std::shared_ptr<AssetHandle>& handle)
+                                       { return handle->_isAwaitingUpload(); });
+    return static_cast<int>(m_queue.size()) + static_cast<int>(waiting) + m_decoding;
+}
+
+std::shared_ptr<AssetHandle> AssetLoader::enqueue(const std::string& filePath,
+                                                  const AssetHandle::Kind kind,
+                                                  const bool premultiplied)
+{
+    if (filePath.empty())
+        throw std::invalid_argument("File path cannot be empty");
+
+    auto handle = std::make_shared<AssetHandle>(filePath, kind, premultiplied);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(handle);
+    }
+    m_wake.notify_one();
+    return handle;
+}
+
+void AssetLoader::workerLoop()
+{
+    // Decoding converts pixels on this thread rather than taking the shared kernel pool, so a
+    // main thread transform never waits behind a background load
+    parallel::SerialScope serial;
+
+    for (;;)
+    {
+        std::shared_ptr<AssetHandle> handle;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+            if (m_stopping)
+                return;
+            handle = std::move(m_queue.front());
+            m_queue.pop_front();
+            ++m_decoding;
+        }
+
+        handle->_decode();
+
+        // Hand the handle over rather than keeping a reference, so the last reference to a
+        // texture is never dropped on this thread
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_decoding;
+        if (handle->getKind() == AssetHandle::Kind::TEXTURE && !handle->isFailed())
+            m_uploads.push_back(std::move(handle));
+    }
+}
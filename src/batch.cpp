@@ -0,0 +1,137 @@
+#include "Batch.hpp"
+#include "Renderer.hpp"
+
+#include <cmath>
+#include <utility>
+
+#ifndef M_PI
+#define M_PI 3.1415926535897932384626433832795
+#endif
+
+namespace
+{
+struct Run
+{
+    SDL_Texture* texture = nullptr;
+    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+    int vertexStart = 0;
+    int vertexCount = 0;
+    int indexStart = 0;
+    int indexCount = 0;
+};
+
+bool _active = false;
+std::vector<SDL_Vertex> _vertices;
+std::vector<int> _indices;
+std::vector<Run> _runs;
+} // namespace
+
+namespace batch
+{
+void begin()
+{
+    flush();
+    _active = true;
+}
+
+void end()
+{
+    flush();
+    _active = false;
+}
+
+bool isActive() { return _active; }
+
+void add(SDL_Texture* texture, const Quad& quad)
+{
+    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+    SDL_GetTextureBlendMode(texture, &blendMode);
+
+    if (_runs.empty() || _runs.back().texture != texture || _runs.back().blendMode != blendMode)
+        _runs.push_back({texture, blendMode, static_cast<int>(_vertices.size()), 0,
+                         static_cast<int>(_indices.size()), 0});
+
+    Run& run = _runs.back();
+    appendQuad(_vertices, _indices, quad, static_cast<float>(texture->w),
+               static_cast<float>(texture->h));
+
+    // Indices are relative to the run's first vertex so each draw only hands SDL its own slice
+    for (auto it = _indices.end() - 6; it != _indices.end(); ++it)
+        *it -= run.vertexStart;
+
+    run.vertexCount += 4;
+    run.indexCount += 6;
+}
+
+void flush()
+{
+    if (_runs.empty())
+        return;
+
+    SDL_Renderer* rend = renderer::get();
+
+    for (const Run& run : _runs)
+    {
+        SDL_BlendMode current = run.blendMode;
+        SDL_GetTextureBlendMode(run.texture, &current);
+        if (current != run.blendMode)
+            SDL_SetTextureBlendMode(run.texture, run.blendMode);
+
+        SDL_RenderGeometry(rend, run.texture, _vertices.data() + run.vertexStart, run.vertexCount,
+                           _indices.data() + run.indexStart, run.indexCount);
+
+        if (current != run.blendMode)
+            SDL_SetTextureBlendMode(run.texture, current);
+    }
+
+    _vertices.clear();
+    _indices.clear();
+    _runs.clear();
+}
+
+void appendQuad(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices, const Quad& quad,
+                const float texWidth, const float texHeight)
+{
+    float u0 = quad.src.x / texWidth;
+    float v0 = quad.src.y / texHeight;
+    float u1 = (quad.src.x + quad.src.w) / texWidth;
+    float v1 = (quad.src.y + quad.src.h) / texHeight;
+    if (quad.flip & SDL_FLIP_HORIZONTAL)
+        std::swap(u0, u1);
+    if (quad.flip & SDL_FLIP_VERTICAL)
+        std::swap(v0, v1);
+
+    const float hw = quad.dst.w * 0.5f;
+    const float hh = quad.dst.h * 0.5f;
+    const float cx = quad.dst.x + hw;
+    const float cy = quad.dst.y + hh;
+
+    // Rotate the corners clockwise about the center, matching SDL_RenderTextureRotated
+    float cosA = 1.f, sinA = 0.f;
+    if (quad.angle != 0.0)
+    {
+        const double rad = quad.angle * (M_PI / 180.0);
+        cosA = static_cast<float>(std::cos(rad));
+        sinA = static_cast<float>(std::sin(rad));
+    }
+
+    const float cornersX[4] = {-hw, hw, hw, -hw};
+    const float cornersY[4] = {-hh, -hh, hh, hh};
+    const float us[4] = {u0, u1, u1, u0};
+    const float vs[4] = {v0, v0, v1, v1};
+
+    const auto base = static_cast<int>(vertices.size());
+    for (int i = 0; i < 4; ++i)
+    {
+        SDL_Vertex vertex;
+        vertex.position.x = cx + cornersX[i] * cosA - cornersY[i] * sinA;
+        vertex.position.y = cy + cornersX[i] * sinA + cornersY[i] * cosA;
+        vertex.color = quad.color;
+        vertex.tex_coord.x = us[i];
+        vertex.tex_coord.y = vs[i];
+        vertices.push_back(vertex);
+    }
+
+    indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+}
+} // namespace batch
@@ -21,6 +21,13 @@ void constants::_bind(py::module_& module)
         .export_values()
         .finalize();
 
+    // Define BlurQuality enum
+    py::native_enum<BlurQuality>(module, "BlurQuality", "enum.IntEnum")
+        .value("EXACT", BlurQuality::EXACT)
+        .value("FAST", BlurQuality::FAST)
+        .export_values()
+        .finalize();
+
     // Define event types
     py::native_enum<SDL_EventType>(module, "EventType", "enum.IntEnum")
         .value("QUIT", SDL_EVENT_QUIT)
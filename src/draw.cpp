@@ -1,4 +1,5 @@
 #include "Draw.hpp"
+#include "Batch.hpp"
 #include "Camera.hpp"
 #include "Circle.hpp"
 #include "Color.hpp"
@@ -8,14 +9,35 @@
 #include "Rect.hpp"
 #include "Renderer.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <gfx/SDL3_gfxPrimitives.h>
 #include <pybind11/stl.h>
-#include <set>
 
-static void _circleThin(SDL_Renderer* renderer, Vec2 center, int radius, const Color& color);
-static void _circle(SDL_Renderer* renderer, Vec2 center, int radius, const Color& color,
-                    int thickness);
-static Uint64 packPoint(int x, int y);
+#ifndef M_PI
+#define M_PI 3.1415926535897932384626433832795
+#endif
+
+// Shared scratch buffers for shapes submitted as untextured geometry
+static std::vector<SDL_Vertex> _shapeVertices;
+static std::vector<int> _shapeIndices;
+
+using ColorArray = py::array_t<uint8_t, py::array::c_style | py::array::forcecast>;
+
+static void _appendEllipse(float cx, float cy, float rx, float ry, int thickness,
+                           const SDL_FColor& color);
+static void _appendRect(const SDL_FRect& rect, const SDL_FColor& color);
+static void _appendLine(float x1, float y1, float x2, float y2, float thickness,
+                        const SDL_FColor& color);
+static void _appendPolygon(const SDL_FPoint* points, int count, bool filled,
+                           const SDL_FColor& color);
+static void _appendOutline(const SDL_FPoint* points, int count, const SDL_FColor& color);
+static bool _submitLine(float x1, float y1, float x2, float y2, float thickness);
+static void _renderShapes(const char* what);
+static const uint8_t* _colorsArg(const py::object& colors, size_t n, ColorArray& holder);
+static SDL_FColor _itemColor(const uint8_t* colors, size_t i, const SDL_FColor& fallback);
+static SDL_FRect _pointBounds(const std::vector<SDL_FPoint>& points);
 
 namespace draw
 {
@@ -34,19 +56,23 @@ Raises:
     RuntimeError: If point rendering fails.
     )doc");
 
-    subDraw.def("points", &points, py::arg("points"), py::arg("color"), R"doc(
+    subDraw.def("points", &points, py::arg("points"), py::arg("color"),
+                py::arg("colors") = py::none(), R"doc(
 Batch draw an array of points to the renderer.
 
 Args:
     points (Sequence[Vec2]): The points to batch draw.
     color (Color): The color of the points.
+    colors (numpy.ndarray, optional): Array with shape (N,4) of per-point RGBA uint8 values
+                                      that overrides color. Defaults to None.
 
 Raises:
+    ValueError: If the colors array shape is invalid.
     RuntimeError: If point rendering fails.
     )doc");
 
     subDraw.def("points_from_ndarray", &pointsFromNDarray, py::arg("points"), py::arg("color"),
-                R"doc(
+                py::arg("colors") = py::none(), R"doc(
 Batch draw points from a NumPy array.
 
 This fast path accepts a contiguous NumPy array of shape (N,2) (dtype float64) and
@@ -56,9 +82,11 @@ zero-copy/buffer-backed path.
 Args:
     points (numpy.ndarray): Array with shape (N,2) containing x,y coordinates.
     color (Color): The color of the points.
+    colors (numpy.ndarray, optional): Array with shape (N,4) of per-point RGBA uint8 values
+                                      that overrides color. Defaults to None.
 
 Raises:
-    ValueError: If the array shape is not (N,2).
+    ValueError: If an array shape is invalid.
     RuntimeError: If point rendering fails.
     )doc");
 
@@ -73,6 +101,45 @@ Args:
                               Defaults to 0 (filled).
     )doc");
 
+    subDraw.def("circles", &circles, py::arg("circles"), py::arg("color"),
+                py::arg("thickness") = 0, R"doc(
+Batch draw an array of circles to the renderer in a single geometry submission.
+
+Args:
+    circles (Sequence[Circle]): The circles to batch draw.
+    color (Color): The color of the circles.
+    thickness (int, optional): The line thickness. If 0 or >= radius, draws filled circles.
+                              Defaults to 0 (filled).
+    )doc");
+
+    subDraw.def("circles_from_ndarray", &circlesFromNDarray, py::arg("circles"), py::arg("color"),
+                py::arg("thickness") = 0, py::arg("colors") = py::none(), R"doc(
+Batch draw circles from a NumPy array in a single geometry submission.
+
+Args:
+    circles (numpy.ndarray): Array with shape (N,3) containing x, y, radius values.
+    color (Color): The color of the circles.
+    thickness (int, optional): The line thickness. If 0 or >= radius, draws filled circles.
+                              Defaults to 0 (filled).
+    colors (numpy.ndarray, optional): Array with shape (N,4) of per-circle RGBA uint8 values
+                                      that overrides color. Defaults to None.
+
+Raises:
+    ValueError: If an array shape is invalid.
+    RuntimeError: If circle rendering fails.
+    )doc");
+
+    subDraw.def("ellipse", &ellipse, py::arg("rect"), py::arg("color"), py::arg("thickness") = 0,
+                R"doc(
+Draw an ellipse inscribed in a rectangle to the renderer.
+
+Args:
+    rect (Rect): The bounding rectangle of the ellipse.
+    color (Color): The color of the ellipse.
+    thickness (int, optional): The line thickness. If 0 or >= the smaller radius, draws a
+                              filled ellipse. Defaults to 0 (filled).
+    )doc");
+
     subDraw.def("line", &line, py::arg("line"), py::arg("color"), py::arg("thickness") = 1,
                 R"doc(
 Draw a line to the renderer.
@@ -83,6 +150,35 @@ Args:
     thickness (int, optional): The line thickness in pixels. Defaults to 1.
     )doc");
 
+    subDraw.def("lines", &lines, py::arg("lines"), py::arg("color"), py::arg("thickness") = 1,
+                R"doc(
+Batch draw an array of lines to the renderer in a single geometry submission.
+
+Args:
+    lines (Sequence[Line]): The lines to batch draw.
+    color (Color): The color of the lines.
+    thickness (int, optional): The line thickness. Defaults to 1.
+
+Raises:
+    RuntimeError: If line rendering fails.
+    )doc");
+
+    subDraw.def("lines_from_ndarray", &linesFromNDarray, py::arg("lines"), py::arg("color"),
+                py::arg("thickness") = 1, py::arg("colors") = py::none(), R"doc(
+Batch draw lines from a NumPy array in a single geometry submission.
+
+Args:
+    lines (numpy.ndarray): Array with shape (N,4) containing ax, ay, bx, by values.
+    color (Color): The color of the lines.
+    thickness (int, optional): The line thickness. Defaults to 1.
+    colors (numpy.ndarray, optional): Array with shape (N,4) of per-line RGBA uint8 values
+                                      that overrides color. Defaults to None.
+
+Raises:
+    ValueError: If an array shape is invalid.
+    RuntimeError: If line rendering fails.
+    )doc");
+
     subDraw.def("rect", &rect, py::arg("rect"), py::arg("color"), py::arg("thickness") = 0,
                 R"doc(
 Draw a rectangle to the renderer.
@@ -94,13 +190,33 @@ Args:
     )doc");
 
     subDraw.def("rects", &rects, py::arg("rects"), py::arg("color"), py::arg("thickness") = 0,
-                R"doc(
+                py::arg("colors") = py::none(), R"doc(
 Batch draw an array of rectangles to the renderer.
 
 Args:
     rects (Sequence[Rect]): The rectangles to batch draw.
     color (Color): The color of the rectangles.
     thickness (int, optional): The border thickness of the rectangles. If 0 or >= half width/height, draws filled rectangles. Defaults to 0 (filled).
+    colors (numpy.ndarray, optional): Array with shape (N,4) of per-rectangle RGBA uint8 values
+                                      that overrides color. Defaults to None.
+
+Raises:
+    ValueError: If the colors array shape is invalid.
+    )doc");
+
+    subDraw.def("rects_from_ndarray", &rectsFromNDarray, py::arg("rects"), py::arg("color"),
+                py::arg("colors") = py::none(), R"doc(
+Batch draw filled rectangles from a NumPy array in a single geometry submission.
+
+Args:
+    rects (numpy.ndarray): Array with shape (N,4) containing x, y, w, h values.
+    color (Color): The color of the rectangles.
+    colors (numpy.ndarray, optional): Array with shape (N,4) of per-rectangle RGBA uint8 values
+                                      that overrides color. Defaults to None.
+
+Raises:
+    ValueError: If an array shape is invalid.
+    RuntimeError: If rectangle rendering fails.
     )doc");
 
     subDraw.def("polygon", &polygon, py::arg("polygon"), py::arg("color"),
@@ -114,23 +230,69 @@ Args:
     filled (bool, optional): Whether to draw a filled polygon or just the outline.
                              Defaults to False (outline). Works with both convex and concave polygons.
     )doc");
+
+    subDraw.def("polygons", &polygons, py::arg("polygons"), py::arg("color"),
+                py::arg("filled") = false, R"doc(
+Batch draw an array of polygons to the renderer in a single geometry submission.
+
+Args:
+    polygons (Sequence[Polygon]): The polygons to batch draw.
+    color (Color): The color of the polygons.
+    filled (bool, optional): Whether to draw filled polygons or just the outlines.
+                             Defaults to False (outline). Filled polygons may be concave
+                             but must not self-intersect.
+
+Raises:
+    RuntimeError: If polygon rendering fails.
+    )doc");
+
+    subDraw.def("polygons_from_ndarray", &polygonsFromNDarray, py::arg("vertices"),
+                py::arg("offsets"), py::arg("color"), py::arg("filled") = false,
+                py::arg("colors") = py::none(), R"doc(
+Batch draw polygons stored in a flat vertex array in a single geometry submission.
+
+Polygon i uses the vertices from offsets[i] up to offsets[i + 1], so K polygons need
+K + 1 offsets starting at 0 and ending at the number of vertices.
+
+Args:
+    vertices (numpy.ndarray): Array with shape (M,2) containing x, y values.
+    offsets (numpy.ndarray): Array with shape (K+1,) of ascending vertex start indices.
+    color (Color): The color of the polygons.
+    filled (bool, optional): Whether to draw filled polygons or just the outlines.
+                             Defaults to False (outline).
+    colors (numpy.ndarray, optional): Array with shape (K,4) of per-polygon RGBA uint8 values
+                                      that overrides color. Defaults to None.
+
+Raises:
+    ValueError: If an array shape or the offsets are invalid.
+    RuntimeError: If polygon rendering fails.
+    )doc");
 }
 
 void point(const Vec2& point, const Color& color)
 {
+    batch::flush();
+
     SDL_Renderer* rend = renderer::get();
     SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a);
 
     SDL_FPoint sdlPoint = point - camera::getActivePos();
+    if (!renderer::_submit({sdlPoint.x, sdlPoint.y, 1.f, 1.f}))
+        return;
     if (!SDL_RenderPoint(rend, sdlPoint.x, sdlPoint.y))
         throw std::runtime_error("Failed to render point: " + std::string(SDL_GetError()));
 }
 
-void points(const std::vector<Vec2>& points, const Color& color)
+void points(const std::vector<Vec2>& points, const Color& color, py::object colors)
 {
     if (points.empty())
         return;
 
+    ColorArray colorHolder;
+    const uint8_t* colorData = _colorsArg(colors, points.size(), colorHolder);
+
+    batch::flush();
+
     SDL_Renderer* rend = renderer::get();
 
     SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a);
@@ -139,22 +301,38 @@ void points(const std::vector<Vec2>& points, const Color& color)
     sdlPoints.reserve(points.size());
 
     const Vec2 cameraPos = camera::getActivePos();
-    const Vec2 max = renderer::getResolution() - cameraPos;
+    const Vec2 max = renderer::_viewSize() - cameraPos;
     const Vec2 min = -cameraPos;
-    for (const Vec2& point : points)
+    for (size_t i = 0; i < points.size(); ++i)
     {
-        const Vec2 pos = point - cameraPos;
-        if (min < pos && pos < max)
-            sdlPoints.emplace_back(pos);
+        const Vec2 pos = points[i] - cameraPos;
+        if (!(min < pos && pos < max))
+            continue;
+
+        sdlPoints.emplace_back(pos);
+        if (colorData)
+            _appendRect({std::floor(sdlPoints.back().x), std::floor(sdlPoints.back().y), 1.f, 1.f},
+                        _itemColor(colorData, i, {}));
     }
 
+    if (colorData)
+    {
+        if (renderer::_submit(_pointBounds(sdlPoints)))
+            _renderShapes("points");
+        _shapeVertices.clear();
+        _shapeIndices.clear();
+        return;
+    }
+
+    if (!renderer::_submit(_pointBounds(sdlPoints)))
+        return;
     if (!SDL_RenderPoints(rend, sdlPoints.data(), static_cast<int>(sdlPoints.size())))
         throw std::runtime_error("Failed to render points: " + std::string(SDL_GetError()));
 }
 
 // Accept a NumPy ndarray with shape (N,2) and dtype float64 for the fastest path.
 void pointsFromNDarray(py::array_t<double, py::array::c_style | py::array::forcecast> arr,
-                       const Color& color)
+                       const Color& color, py::object colors)
 {
     auto info = arr.request();
     if (info.ndim != 2 || info.shape[1] != 2)
@@ -166,13 +344,18 @@ void pointsFromNDarray(py::array_t<double, py::array::c_style | py::array::force
 
     const double* data = static_cast<double*>(info.ptr);
 
+    ColorArray colorHolder;
+    const uint8_t* colorData = _colorsArg(colors, n, colorHolder);
+
+    batch::flush();
+
     SDL_Renderer* rend = renderer::get();
     SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a);
 
     std::vector<SDL_FPoint> sdlPoints;
     sdlPoints.reserve(n);
 
-    const Vec2 res = renderer::getResolution();
+    const Vec2 res = renderer::_viewSize();
     const Vec2 cameraPos = camera::getActivePos();
     const Vec2 zero;
 
@@ -180,10 +363,26 @@ void pointsFromNDarray(py::array_t<double, py::array::c_style | py::array::force
     {
         Vec2 pos = {data[i * 2 + 0], data[i * 2 + 1]};
         pos -= cameraPos;
-        if (pos > zero && pos < res)
-            sdlPoints.emplace_back(pos);
+        if (!(pos > zero && pos < res))
+            continue;
+
+        sdlPoints.emplace_back(pos);
+        if (colorData)
+            _appendRect({std::floor(sdlPoints.back().x), std::floor(sdlPoints.back().y), 1.f, 1.f},
+                        _itemColor(colorData, i, {}));
+    }
+
+    if (colorData)
+    {
+        if (renderer::_submit(_pointBounds(sdlPoints)))
+            _renderShapes("points");
+        _shapeVertices.clear();
+        _shapeIndices.clear();
+        return;
     }
 
+    if (!renderer::_submit(_pointBounds(sdlPoints)))
+        return;
     if (!SDL_RenderPoints(rend, sdlPoints.data(), static_cast<int>(sdlPoints.size())))
         throw std::runtime_error("Failed to render points: " + std::string(SDL_GetError()));
 }
@@ -193,22 +392,122 @@ void circle(const Circle& circle, const Color& color, const int thickness)
     if (circle.radius < 1)
         return;
 
-    SDL_Renderer* rend = renderer::get();
-    SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a);
+    const Vec2 center = circle.pos - camera::getActivePos();
+    const auto radius = static_cast<float>(circle.radius);
+    if (!renderer::_submit({static_cast<float>(center.x) - radius,
+                            static_cast<float>(center.y) - radius, radius * 2.f + 1.f,
+                            radius * 2.f + 1.f}))
+        return;
 
-    if (thickness == 1)
-        _circleThin(rend, circle.pos - camera::getActivePos(), circle.radius, color);
-    else
-        _circle(rend, circle.pos - camera::getActivePos(), circle.radius, color, thickness);
+    batch::flush();
+
+    _appendEllipse(static_cast<float>(center.x), static_cast<float>(center.y), radius, radius,
+                   thickness, color);
+    _renderShapes("circle");
+}
+
+void circles(const std::vector<Circle>& circles, const Color& color, const int thickness)
+{
+    if (circles.empty())
+        return;
+
+    batch::flush();
+
+    const SDL_FColor fColor = color;
+    const Vec2 cameraPos = camera::getActivePos();
+    for (const Circle& circle : circles)
+    {
+        if (circle.radius < 1)
+            continue;
+
+        const auto cx = static_cast<float>(circle.pos.x - cameraPos.x);
+        const auto cy = static_cast<float>(circle.pos.y - cameraPos.y);
+        const auto radius = static_cast<float>(circle.radius);
+        if (renderer::_submit({cx - radius, cy - radius, radius * 2.f + 1.f, radius * 2.f + 1.f}))
+            _appendEllipse(cx, cy, radius, radius, thickness, fColor);
+    }
+
+    _renderShapes("circles");
+}
+
+// Accept a NumPy ndarray with shape (N,3) and dtype float64 holding x, y, radius rows.
+void circlesFromNDarray(py::array_t<double, py::array::c_style | py::array::forcecast> arr,
+                        const Color& color, const int thickness, py::object colors)
+{
+    auto info = arr.request();
+    if (info.ndim != 2 || info.shape[1] != 3)
+        throw std::invalid_argument("Expected array shape (N,3)");
+
+    const auto n = static_cast<size_t>(info.shape[0]);
+    if (n == 0)
+        return;
+
+    const double* data = static_cast<double*>(info.ptr);
+
+    ColorArray colorHolder;
+    const uint8_t* colorData = _colorsArg(colors, n, colorHolder);
+
+    batch::flush();
+
+    const SDL_FColor fColor = color;
+    const Vec2 cameraPos = camera::getActivePos();
+    for (size_t i = 0; i < n; ++i)
+    {
+        const double* row = data + i * 3;
+        if (row[2] < 1.0)
+            continue;
+
+        const auto cx = static_cast<float>(row[0] - cameraPos.x);
+        const auto cy = static_cast<float>(row[1] - cameraPos.y);
+        const auto radius = static_cast<float>(row[2]);
+        if (renderer::_submit({cx - radius, cy - radius, radius * 2.f + 1.f, radius * 2.f + 1.f}))
+            _appendEllipse(cx, cy, radius, radius, thickness, _itemColor(colorData, i, fColor));
+    }
+
+    _renderShapes("circles");
+}
+
+void ellipse(Rect rect, const Color& color, const int thickness)
+{
+    const auto rx = static_cast<float>(rect.w * 0.5);
+    const auto ry = static_cast<float>(rect.h * 0.5);
+    if (rx < 0.5f || ry < 0.5f)
+        return;
+
+    const Vec2 cameraPos = camera::getActivePos();
+    rect.x -= cameraPos.x;
+    rect.y -= cameraPos.y;
+    if (!renderer::_submit(rect))
+        return;
+
+    batch::flush();
+
+    _appendEllipse(static_cast<float>(rect.x) + rx, static_cast<float>(rect.y) + ry, rx, ry,
+                   thickness, color);
+    _renderShapes("ellipse");
 }
 
 void line(const Line& line, const Color& color, const int thickness)
 {
     const Vec2 cameraPos = camera::getActivePos();
-    const auto x1 = static_cast<Sint16>(line.ax - cameraPos.x);
-    const auto y1 = static_cast<Sint16>(line.ay - cameraPos.y);
-    const auto x2 = static_cast<Sint16>(line.bx - cameraPos.x);
-    const auto y2 = static_cast<Sint16>(line.by - cameraPos.y);
+    const double ax = line.ax - cameraPos.x;
+    const double ay = line.ay - cameraPos.y;
+    const double bx = line.bx - cameraPos.x;
+    const double by = line.by - cameraPos.y;
+
+    const double pad = std::max(thickness, 1) * 0.5 + 1.0;
+    if (!renderer::_submit({static_cast<float>(std::min(ax, bx) - pad),
+                            static_cast<float>(std::min(ay, by) - pad),
+                            static_cast<float>(std::abs(bx - ax) + pad * 2.0),
+                            static_cast<float>(std::abs(by - ay) + pad * 2.0)}))
+        return;
+
+    batch::flush();
+
+    const auto x1 = static_cast<Sint16>(ax);
+    const auto y1 = static_cast<Sint16>(ay);
+    const auto x2 = static_cast<Sint16>(bx);
+    const auto y2 = static_cast<Sint16>(by);
 
     if (thickness <= 1)
         lineRGBA(renderer::get(), x1, y1, x2, y2, color.r, color.g, color.b, color.a);
@@ -217,8 +516,69 @@ void line(const Line& line, const Color& color, const int thickness)
                       color.a);
 }
 
+void lines(const std::vector<Line>& lines, const Color& color, const int thickness)
+{
+    if (lines.empty())
+        return;
+
+    batch::flush();
+
+    const SDL_FColor fColor = color;
+    const auto width = static_cast<float>(std::max(thickness, 1));
+    const Vec2 cameraPos = camera::getActivePos();
+    for (const Line& line : lines)
+    {
+        const auto ax = static_cast<float>(line.ax - cameraPos.x);
+        const auto ay = static_cast<float>(line.ay - cameraPos.y);
+        const auto bx = static_cast<float>(line.bx - cameraPos.x);
+        const auto by = static_cast<float>(line.by - cameraPos.y);
+        if (_submitLine(ax, ay, bx, by, width))
+            _appendLine(ax, ay, bx, by, width, fColor);
+    }
+
+    _renderShapes("lines");
+}
+
+// Accept a NumPy ndarray with shape (N,4) and dtype float64 holding ax, ay, bx, by rows.
+void linesFromNDarray(py::array_t<double, py::array::c_style | py::array::forcecast> arr,
+                      const Color& color, const int thickness, py::object colors)
+{
+    auto info = arr.request();
+    if (info.ndim != 2 || info.shape[1] != 4)
+        throw std::invalid_argument("Expected array shape (N,4)");
+
+    const auto n = static_cast<size_t>(info.shape[0]);
+    if (n == 0)
+        return;
+
+    const double* data = static_cast<double*>(info.ptr);
+
+    ColorArray colorHolder;
+    const uint8_t* colorData = _colorsArg(colors, n, colorHolder);
+
+    batch::flush();
+
+    const SDL_FColor fColor = color;
+    const auto width = static_cast<float>(std::max(thickness, 1));
+    const Vec2 cameraPos = camera::getActivePos();
+    for (size_t i = 0; i < n; ++i)
+    {
+        const double* row = data + i * 4;
+        const auto ax = static_cast<float>(row[0] - cameraPos.x);
+        const auto ay = static_cast<float>(row[1] - cameraPos.y);
+        const auto bx = static_cast<float>(row[2] - cameraPos.x);
+        const auto by = static_cast<float>(row[3] - cameraPos.y);
+        if (_submitLine(ax, ay, bx, by, width))
+            _appendLine(ax, ay, bx, by, width, _itemColor(colorData, i, fColor));
+    }
+
+    _renderShapes("lines");
+}
+
 void rect(Rect rect, const Color& color, const int thickness)
 {
+    batch::flush();
+
     SDL_Renderer* rend = renderer::get();
     SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a);
 
@@ -226,6 +586,8 @@ void rect(Rect rect, const Color& color, const int thickness)
     rect.x -= cameraPos.x;
     rect.y -= cameraPos.y;
     SDL_FRect sdlRect = rect;
+    if (!renderer::_submit(sdlRect))
+        return;
 
     const auto halfWidth = static_cast<int>(rect.w / 2.0);
     const auto halfHeight = static_cast<int>(rect.h / 2.0);
@@ -244,16 +606,54 @@ void rect(Rect rect, const Color& color, const int thickness)
     }
 }
 
-void rects(const std::vector<Rect>& rects, const Color& color, const int thickness)
+void rects(const std::vector<Rect>& rects, const Color& color, const int thickness,
+           py::object colors)
 {
     if (rects.empty())
         return;
 
+    ColorArray colorHolder;
+    const uint8_t* colorData = _colorsArg(colors, rects.size(), colorHolder);
+
+    batch::flush();
+
     SDL_Renderer* rend = renderer::get();
     SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a);
 
     const Vec2 cameraPos = camera::getActivePos();
 
+    // Per-rect colors go through geometry, with outlines built from four border quads
+    if (colorData)
+    {
+        for (size_t i = 0; i < rects.size(); ++i)
+        {
+            const SDL_FRect sdlRect = {static_cast<float>(rects[i].x - cameraPos.x),
+                                       static_cast<float>(rects[i].y - cameraPos.y),
+                                       static_cast<float>(rects[i].w),
+                                       static_cast<float>(rects[i].h)};
+            if (!renderer::_submit(sdlRect))
+                continue;
+
+            const SDL_FColor itemColor = _itemColor(colorData, i, {});
+            const auto t = static_cast<float>(thickness);
+            if (thickness <= 0 || thickness > static_cast<int>(sdlRect.w / 2.f) ||
+                thickness > static_cast<int>(sdlRect.h / 2.f))
+            {
+                _appendRect(sdlRect, itemColor);
+                continue;
+            }
+
+            const float x = sdlRect.x, y = sdlRect.y, w = sdlRect.w, h = sdlRect.h;
+            _appendRect({x, y, w, t}, itemColor);
+            _appendRect({x, y + h - t, w, t}, itemColor);
+            _appendRect({x, y + t, t, h - t * 2.f}, itemColor);
+            _appendRect({x + w - t, y + t, t, h - t * 2.f}, itemColor);
+        }
+
+        _renderShapes("rects");
+        return;
+    }
+
     // Convert to SDL_FRect array with camera offset
     std::vector<SDL_FRect> sdlRects;
     sdlRects.reserve(rects.size());
@@ -265,9 +665,13 @@ void rects(const std::vector<Rect>& rects, const Color& color, const int thickne
         sdlRect.y = rect.y - cameraPos.y;
         sdlRect.w = rect.w;
         sdlRect.h = rect.h;
-        sdlRects.push_back(sdlRect);
+        if (renderer::_submit(sdlRect))
+            sdlRects.push_back(sdlRect);
     }
 
+    if (sdlRects.empty())
+        return;
+
     // For filled rectangles or thick outlines, use batch fill
     if (thickness <= 0)
         SDL_RenderFillRects(rend, sdlRects.data(), static_cast<int>(sdlRects.size()));
@@ -282,22 +686,23 @@ void rects(const std::vector<Rect>& rects, const Color& color, const int thickne
             for (int i = 1; i < thickness; i++)
             {
                 std::vector<SDL_FRect> innerRects;
-                innerRects.reserve(rects.size());
+                innerRects.reserve(sdlRects.size());
 
-                for (const Rect& rect : rects)
+                // Only the rects that survived culling
+                for (const SDL_FRect& sdlRect : sdlRects)
                 {
-                    const auto halfWidth = static_cast<int>(rect.w / 2.0);
-                    const auto halfHeight = static_cast<int>(rect.h / 2.0);
+                    const auto halfWidth = static_cast<int>(sdlRect.w / 2.f);
+                    const auto halfHeight = static_cast<int>(sdlRect.h / 2.f);
 
                     // Skip if thickness would exceed rectangle dimensions
                     if (i >= halfWidth || i >= halfHeight)
                         continue;
 
                     SDL_FRect innerRect;
-                    innerRect.x = rect.x - cameraPos.x + i;
-                    innerRect.y = rect.y - cameraPos.y + i;
-                    innerRect.w = rect.w - (2 * i);
-                    innerRect.h = rect.h - (2 * i);
+                    innerRect.x = sdlRect.x + i;
+                    innerRect.y = sdlRect.y + i;
+                    innerRect.w = sdlRect.w - (2 * i);
+                    innerRect.h = sdlRect.h - (2 * i);
                     innerRects.push_back(innerRect);
                 }
 
@@ -308,6 +713,43 @@ void rects(const std::vector<Rect>& rects, const Color& color, const int thickne
     }
 }
 
+// Accept a NumPy ndarray with shape (N,4) and dtype float64 holding x, y, w, h rows.
+void rectsFromNDarray(py::array_t<double, py::array::c_style | py::array::forcecast> arr,
+                      const Color& color, py::object colors)
+{
+    auto info = arr.request();
+    if (info.ndim != 2 || info.shape[1] != 4)
+        throw std::invalid_argument("Expected array shape (N,4)");
+
+    const auto n = static_cast<size_t>(info.shape[0]);
+    if (n == 0)
+        return;
+
+    const double* data = static_cast<double*>(info.ptr);
+
+    ColorArray colorHolder;
+    const uint8_t* colorData = _colorsArg(colors, n, colorHolder);
+
+    batch::flush();
+
+    const SDL_FColor fColor = color;
+    const Vec2 cameraPos = camera::getActivePos();
+    for (size_t i = 0; i < n; ++i)
+    {
+        const double* row = data + i * 4;
+        const auto x0 = static_cast<float>(row[0] - cameraPos.x);
+        const auto y0 = static_cast<float>(row[1] - cameraPos.y);
+        const auto w = static_cast<float>(row[2]);
+        const auto h = static_cast<float>(row[3]);
+        if (w <= 0.f || h <= 0.f || !renderer::_submit({x0, y0, w, h}))
+            continue;
+
+        _appendRect({x0, y0, w, h}, _itemColor(colorData, i, fColor));
+    }
+
+    _renderShapes("rects");
+}
+
 void polygon(const Polygon& polygon, const Color& color, const bool filled)
 {
     const size_t size = polygon.points.size();
@@ -324,6 +766,8 @@ void polygon(const Polygon& polygon, const Color& color, const bool filled)
         return;
     }
 
+    batch::flush();
+
     const Vec2 cameraPos = camera::getActivePos();
 
     std::vector<Sint16> vx(size);
@@ -334,6 +778,13 @@ void polygon(const Polygon& polygon, const Color& color, const bool filled)
         vy[i] = static_cast<Sint16>(polygon.points.at(i).y - cameraPos.y);
     }
 
+    const auto [minX, maxX] = std::minmax_element(vx.begin(), vx.end());
+    const auto [minY, maxY] = std::minmax_element(vy.begin(), vy.end());
+    if (!renderer::_submit({static_cast<float>(*minX), static_cast<float>(*minY),
+                            static_cast<float>(*maxX - *minX + 1),
+                            static_cast<float>(*maxY - *minY + 1)}))
+        return;
+
     if (filled)
         filledPolygonRGBA(renderer::get(), vx.data(), vy.data(), static_cast<int>(size), color.r,
                           color.g, color.b, color.a);
@@ -341,135 +792,402 @@ void polygon(const Polygon& polygon, const Color& color, const bool filled)
         polygonRGBA(renderer::get(), vx.data(), vy.data(), static_cast<int>(size), color.r, color.g,
                     color.b, color.a);
 }
-} // namespace draw
 
-void _circleThin(SDL_Renderer* renderer, Vec2 center, const int radius, const Color& color)
+void polygons(const std::vector<Polygon>& polygons, const Color& color, const bool filled)
 {
-    int f = 1 - radius;
-    int ddF_x = 0;
-    int ddF_y = -2 * radius;
-    int x = 0;
-    int y = radius;
+    if (polygons.empty())
+        return;
+
+    batch::flush();
+
+    const SDL_FColor fColor = color;
+    const Vec2 cameraPos = camera::getActivePos();
+    std::vector<SDL_FPoint> points;
+    for (const Polygon& polygon : polygons)
+    {
+        points.clear();
+        for (const Vec2& point : polygon.points)
+            points.push_back({static_cast<float>(point.x - cameraPos.x),
+                              static_cast<float>(point.y - cameraPos.y)});
 
-    std::set<Uint64> pointSet;
+        if (!points.empty() && renderer::_submit(_pointBounds(points)))
+            _appendPolygon(points.data(), static_cast<int>(points.size()), filled, fColor);
+    }
 
-    center -= camera::getActivePos();
-    auto emit = [&](int dx, int dy) { pointSet.insert(packPoint(center.x + dx, center.y + dy)); };
+    _renderShapes("polygons");
+}
 
-    while (x <= y)
+void polygonsFromNDarray(py::array_t<double, py::array::c_style | py::array::forcecast> vertices,
+                         py::array_t<int64_t, py::array::c_style | py::array::forcecast> offsets,
+                         const Color& color, const bool filled, py::object colors)
+{
+    auto vertexInfo = vertices.request();
+    if (vertexInfo.ndim != 2 || vertexInfo.shape[1] != 2)
+        throw std::invalid_argument("Expected vertices array shape (M,2)");
+
+    auto offsetInfo = offsets.request();
+    if (offsetInfo.ndim != 1 || offsetInfo.shape[0] < 1)
+        throw std::invalid_argument("Expected offsets array shape (K+1,)");
+
+    const auto vertexCount = static_cast<int64_t>(vertexInfo.shape[0]);
+    const auto* offsetData = static_cast<const int64_t*>(offsetInfo.ptr);
+    const auto n = static_cast<size_t>(offsetInfo.shape[0] - 1);
+    if (offsetData[0] != 0 || offsetData[n] != vertexCount)
+        throw std::invalid_argument("Offsets must start at 0 and end at the number of vertices");
+    for (size_t i = 0; i < n; ++i)
+        if (offsetData[i] > offsetData[i + 1])
+            throw std::invalid_argument("Offsets must be in ascending order");
+    if (n == 0)
+        return;
+
+    const double* data = static_cast<double*>(vertexInfo.ptr);
+
+    ColorArray colorHolder;
+    const uint8_t* colorData = _colorsArg(colors, n, colorHolder);
+
+    batch::flush();
+
+    const SDL_FColor fColor = color;
+    const Vec2 cameraPos = camera::getActivePos();
+    std::vector<SDL_FPoint> points;
+    for (size_t i = 0; i < n; ++i)
     {
-        emit(x, y);
-        emit(-x, y);
-        emit(x, -y);
-        emit(-x, -y);
-        emit(y, x);
-        emit(-y, x);
-        emit(y, -x);
-        emit(-y, -x);
+        points.clear();
+        for (int64_t v = offsetData[i]; v < offsetData[i + 1]; ++v)
+            points.push_back({static_cast<float>(data[v * 2 + 0] - cameraPos.x),
+                              static_cast<float>(data[v * 2 + 1] - cameraPos.y)});
+
+        if (!points.empty() && renderer::_submit(_pointBounds(points)))
+            _appendPolygon(points.data(), static_cast<int>(points.size()), filled,
+                           _itemColor(colorData, i, fColor));
+    }
 
-        if (f >= 0)
+    _renderShapes("polygons");
+}
+} // namespace draw
+
+// Unit circle tables for power-of-two segment counts from 8 to 1024, built on first use
+static const std::vector<SDL_FPoint>& _unitCircle(const int segments)
+{
+    static std::array<std::vector<SDL_FPoint>, 8> tables;
+
+    int slot = 0;
+    while ((8 << slot) < segments)
+        ++slot;
+
+    std::vector<SDL_FPoint>& table = tables[slot];
+    if (table.empty())
+    {
+        const int count = 8 << slot;
+        table.resize(count);
+        for (int i = 0; i < count; ++i)
         {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
+            const double theta = 2.0 * M_PI * i / count;
+            table[i] = {static_cast<float>(std::cos(theta)), static_cast<float>(std::sin(theta))};
         }
-        x++;
-        ddF_x += 2;
-        f += ddF_x + 1;
     }
+    return table;
+}
 
-    // Convert to SDL_FPoint vector
-    std::vector<SDL_FPoint> points;
-    points.reserve(pointSet.size());
-    for (auto packed : pointSet)
+void _appendEllipse(float cx, float cy, const float rx, const float ry, const int thickness,
+                    const SDL_FColor& color)
+{
+    // Keep the chord error below a quarter pixel, bucketed to a cached table size
+    const float radius = std::max(rx, ry);
+    int segments = 1024;
+    if (radius < 4096.f)
+        segments = static_cast<int>(std::ceil(M_PI / std::acos(1.0 - 0.25 / (radius + 0.25))));
+    const std::vector<SDL_FPoint>& unit = _unitCircle(std::clamp(segments, 8, 1024));
+    const auto count = static_cast<int>(unit.size());
+
+    // Center on the pixel so the shape covers the same pixels as the old scanline rasterizer
+    cx += 0.5f;
+    cy += 0.5f;
+
+    const auto base = static_cast<int>(_shapeVertices.size());
+    if (thickness <= 0 || static_cast<float>(thickness) >= std::min(rx, ry))
+    {
+        // Filled: a triangle fan around the center
+        _shapeVertices.push_back({{cx, cy}, color, {0.f, 0.f}});
+        for (const SDL_FPoint& p : unit)
+            _shapeVertices.push_back({{cx + p.x * rx, cy + p.y * ry}, color, {0.f, 0.f}});
+
+        for (int i = 0; i < count; ++i)
+            _shapeIndices.insert(_shapeIndices.end(),
+                                 {base, base + 1 + i, base + 1 + (i + 1) % count});
+        return;
+    }
+
+    // Ring: a closed strip of outer/inner vertex pairs
+    const auto innerX = rx - static_cast<float>(thickness);
+    const auto innerY = ry - static_cast<float>(thickness);
+    for (const SDL_FPoint& p : unit)
     {
-        int x = int(int32_t(packed >> 32)) - 32768;
-        int y = int(int32_t(packed & 0xFFFFFFFF)) - 32768;
-        points.push_back(SDL_FPoint{float(x), float(y)});
+        _shapeVertices.push_back({{cx + p.x * rx, cy + p.y * ry}, color, {0.f, 0.f}});
+        _shapeVertices.push_back({{cx + p.x * innerX, cy + p.y * innerY}, color, {0.f, 0.f}});
     }
 
-    SDL_RenderPoints(renderer, points.data(), static_cast<int>(points.size()));
+    for (int i = 0; i < count; ++i)
+    {
+        const int outer0 = base + i * 2;
+        const int outer1 = base + ((i + 1) % count) * 2;
+        _shapeIndices.insert(_shapeIndices.end(),
+                             {outer0, outer1, outer0 + 1, outer0 + 1, outer1, outer1 + 1});
+    }
+}
+
+void _appendRect(const SDL_FRect& rect, const SDL_FColor& color)
+{
+    const float x1 = rect.x + rect.w;
+    const float y1 = rect.y + rect.h;
+
+    const auto base = static_cast<int>(_shapeVertices.size());
+    _shapeVertices.push_back({{rect.x, rect.y}, color, {0.f, 0.f}});
+    _shapeVertices.push_back({{x1, rect.y}, color, {0.f, 0.f}});
+    _shapeVertices.push_back({{x1, y1}, color, {0.f, 0.f}});
+    _shapeVertices.push_back({{rect.x, y1}, color, {0.f, 0.f}});
+    _shapeIndices.insert(_shapeIndices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
 }
 
-void _circle(SDL_Renderer* renderer, Vec2 center, const int radius, const Color& color,
-             const int thickness)
+bool _submitLine(const float x1, const float y1, const float x2, const float y2,
+                 const float thickness)
 {
-    const int innerRadius = (thickness <= 0 || thickness >= radius) ? -1 : radius - thickness;
-    center -= camera::getActivePos();
+    const float pad = thickness * 0.5f + 1.f;
+    return renderer::_submit({std::min(x1, x2) - pad, std::min(y1, y2) - pad,
+                              std::abs(x2 - x1) + pad * 2.f, std::abs(y2 - y1) + pad * 2.f});
+}
+
+void _appendLine(const float x1, const float y1, const float x2, const float y2,
+                 const float thickness, const SDL_FColor& color)
+{
+    // Extrude the segment into a quad along its normal, centered on the pixel centers
+    const float dx = x2 - x1;
+    const float dy = y2 - y1;
+    const float length = std::sqrt(dx * dx + dy * dy);
+    const float ux = length > 0.f ? dx / length : 1.f;
+    const float uy = length > 0.f ? dy / length : 0.f;
+    const float nx = -uy * thickness * 0.5f;
+    const float ny = ux * thickness * 0.5f;
+    const float ex = ux * 0.5f;
+    const float ey = uy * 0.5f;
+
+    // Extend both ends by half a pixel so the end points are covered like SDL lines
+    const float ax = x1 + 0.5f - ex, ay = y1 + 0.5f - ey;
+    const float bx = x2 + 0.5f + ex, by = y2 + 0.5f + ey;
+
+    const auto base = static_cast<int>(_shapeVertices.size());
+    _shapeVertices.push_back({{ax + nx, ay + ny}, color, {0.f, 0.f}});
+    _shapeVertices.push_back({{bx + nx, by + ny}, color, {0.f, 0.f}});
+    _shapeVertices.push_back({{bx - nx, by - ny}, color, {0.f, 0.f}});
+    _shapeVertices.push_back({{ax - nx, ay - ny}, color, {0.f, 0.f}});
+    _shapeIndices.insert(_shapeIndices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+}
 
-    auto hline = [&](int x1, int y, int x2)
+void _appendPolygon(const SDL_FPoint* points, const int count, const bool filled,
+                    const SDL_FColor& color)
+{
+    if (!filled || count < 3)
     {
-        SDL_RenderLine(renderer, static_cast<float>(x1), static_cast<float>(y),
-                       static_cast<float>(x2), static_cast<float>(y));
-    };
+        _appendOutline(points, count, color);
+        return;
+    }
 
-    auto drawCircleSpan = [&](int r, std::unordered_map<int, std::pair<int, int>>& bounds)
+    // Ear clipping over a linked ring of vertex indices
+    double area = 0.0;
+    for (int i = 0; i < count; ++i)
     {
-        int x = 0;
-        int y = r;
-        int d = 3 - 2 * r;
+        const SDL_FPoint& a = points[i];
+        const SDL_FPoint& b = points[(i + 1) % count];
+        area += static_cast<double>(a.x) * b.y - static_cast<double>(b.x) * a.y;
+    }
+    if (area == 0.0)
+        return;
+    const float winding = area > 0.0 ? 1.f : -1.f;
+
+    auto cross = [](const SDL_FPoint& o, const SDL_FPoint& a, const SDL_FPoint& b)
+    { return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x); };
+
+    static std::vector<int> ring;
+    ring.resize(count);
+    for (int i = 0; i < count; ++i)
+        ring[i] = i;
 
-        while (x <= y)
+    const auto base = static_cast<int>(_shapeVertices.size());
+    for (int i = 0; i < count; ++i)
+        _shapeVertices.push_back({{points[i].x + 0.5f, points[i].y + 0.5f}, color, {0.f, 0.f}});
+
+    int remaining = count;
+    int guard = 0;
+    int i = 0;
+    while (remaining > 3 && guard < remaining)
+    {
+        const int prev = ring[(i + remaining - 1) % remaining];
+        const int curr = ring[i];
+        const int next = ring[(i + 1) % remaining];
+        const SDL_FPoint& a = points[prev];
+        const SDL_FPoint& b = points[curr];
+        const SDL_FPoint& c = points[next];
+
+        bool isEar = cross(a, b, c) * winding > 0.f;
+        for (int j = 0; isEar && j < remaining; ++j)
         {
-            auto update = [&](int y_offset, int xval)
-            {
-                int yPos = static_cast<int>(center.y) + y_offset;
-                int minX = static_cast<int>(center.x) - xval;
-                int maxX = static_cast<int>(center.x) + xval;
-                bounds[yPos].first = std::min(bounds[yPos].first, minX);
-                bounds[yPos].second = std::max(bounds[yPos].second, maxX);
-            };
-
-            for (int sign : {-1, 1})
-            {
-                update(sign * y, x);
-                update(sign * x, y);
-            }
+            const int other = ring[j];
+            if (other == prev || other == curr || other == next)
+                continue;
+            const SDL_FPoint& p = points[other];
+            isEar = !(cross(a, b, p) * winding >= 0.f && cross(b, c, p) * winding >= 0.f &&
+                      cross(c, a, p) * winding >= 0.f);
+        }
 
-            if (d < 0)
-                d += 4 * x + 6;
-            else
-            {
-                d += 4 * (x - y) + 10;
-                y--;
-            }
-            x++;
+        if (isEar)
+        {
+            _shapeIndices.insert(_shapeIndices.end(), {base + prev, base + curr, base + next});
+            ring.erase(ring.begin() + i);
+            --remaining;
+            guard = 0;
+            if (i >= remaining)
+                i = 0;
+        }
+        else
+        {
+            ++guard;
+            i = (i + 1) % remaining;
         }
-    };
+    }
 
-    std::unordered_map<int, std::pair<int, int>> outerBounds;
-    std::unordered_map<int, std::pair<int, int>> innerBounds;
+    // Degenerate or self-intersecting input can leave no ears; fan the rest instead
+    for (int j = 1; j + 1 < remaining; ++j)
+        _shapeIndices.insert(_shapeIndices.end(),
+                             {base + ring[0], base + ring[j], base + ring[j + 1]});
+}
 
-    // Initialize bounds with max/mins
-    for (int i = -radius; i <= radius; ++i)
+// Append a closed 1px outline as a single mitred strip, so translucent edges never overlap at
+// the shared vertices. One or two distinct points become a single dot or segment
+void _appendOutline(const SDL_FPoint* points, const int count, const SDL_FColor& color)
+{
+    // Repeated points would give zero-length edges with no direction
+    static std::vector<SDL_FPoint> ring;
+    ring.clear();
+    for (int i = 0; i < count; ++i)
+        if (ring.empty() || points[i].x != ring.back().x || points[i].y != ring.back().y)
+            ring.push_back(points[i]);
+    while (ring.size() > 1 && ring.front().x == ring.back().x && ring.front().y == ring.back().y)
+        ring.pop_back();
+
+    const auto n = static_cast<int>(ring.size());
+    if (n == 0)
+        return;
+    if (n <= 2)
     {
-        outerBounds[static_cast<int>(center.y) + i] = {INT_MAX, INT_MIN};
-        innerBounds[static_cast<int>(center.y) + i] = {INT_MAX, INT_MIN};
+        _appendLine(ring[0].x, ring[0].y, ring[n - 1].x, ring[n - 1].y, 1.f, color);
+        return;
     }
 
-    drawCircleSpan(radius, outerBounds);
-    drawCircleSpan(innerRadius, innerBounds);
-
-    for (const auto& [y, outer] : outerBounds)
+    // Unit normal of the edge leaving each vertex
+    static std::vector<SDL_FPoint> normals;
+    normals.resize(n);
+    for (int i = 0; i < n; ++i)
     {
-        const auto& inner = innerBounds[y];
+        const SDL_FPoint& a = ring[i];
+        const SDL_FPoint& b = ring[(i + 1) % n];
+        const float dx = b.x - a.x;
+        const float dy = b.y - a.y;
+        const float length = std::sqrt(dx * dx + dy * dy);
+        normals[i] = {-dy / length, dx / length};
+    }
 
-        if (inner.first == INT_MAX || inner.second == INT_MIN)
-            // No inner circle on this line → full span
-            hline(outer.first, y, outer.second);
+    // Each vertex gets an outer and an inner corner on the bisector of its two edge normals,
+    // pushed out so both edges stay half a pixel wide. Sharp corners are limited to 2px
+    const auto base = static_cast<int>(_shapeVertices.size());
+    for (int i = 0; i < n; ++i)
+    {
+        const SDL_FPoint& in = normals[(i + n - 1) % n];
+        const SDL_FPoint& out = normals[i];
+        float mx = in.x + out.x;
+        float my = in.y + out.y;
+        const float mLength = std::sqrt(mx * mx + my * my);
+        if (mLength < 1e-3f)
+        {
+            // The outline doubles back on itself here
+            mx = out.x;
+            my = out.y;
+        }
         else
         {
-            // Left ring
-            if (outer.first < inner.first)
-                hline(outer.first, y, inner.first - 1);
-            // Right ring
-            if (outer.second > inner.second)
-                hline(inner.second + 1, y, outer.second);
+            mx /= mLength;
+            my /= mLength;
         }
+        const float scale = 0.5f / std::max(mx * out.x + my * out.y, 0.25f);
+
+        const float px = ring[i].x + 0.5f;
+        const float py = ring[i].y + 0.5f;
+        _shapeVertices.push_back({{px + mx * scale, py + my * scale}, color, {0.f, 0.f}});
+        _shapeVertices.push_back({{px - mx * scale, py - my * scale}, color, {0.f, 0.f}});
     }
+
+    for (int i = 0; i < n; ++i)
+    {
+        const int a = base + i * 2;
+        const int b = base + ((i + 1) % n) * 2;
+        _shapeIndices.insert(_shapeIndices.end(), {a, b, b + 1, a, b + 1, a + 1});
+    }
+}
+
+void _renderShapes(const char* what)
+{
+    if (_shapeIndices.empty())
+        return;
+
+    const bool ok = SDL_RenderGeometry(
+        renderer::get(), nullptr, _shapeVertices.data(), static_cast<int>(_shapeVertices.size()),
+        _shapeIndices.data(), static_cast<int>(_shapeIndices.size()));
+    _shapeVertices.clear();
+    _shapeIndices.clear();
+    if (!ok)
+        throw std::runtime_error(std::string("Failed to render ") + what + ": " + SDL_GetError());
 }
 
-Uint64 packPoint(const int x, const int y)
+const uint8_t* _colorsArg(const py::object& colors, const size_t n, ColorArray& holder)
 {
-    return (uint64_t(uint32_t(x + 32768)) << 32) | uint32_t(y + 32768);
+    if (colors.is_none())
+        return nullptr;
+
+    try
+    {
+        holder = colors.cast<ColorArray>();
+    }
+    catch (const py::cast_error&)
+    {
+        throw std::invalid_argument("'colors' must be a NumPy array");
+    }
+
+    if (holder.ndim() != 2 || holder.shape(1) != 4 || static_cast<size_t>(holder.shape(0)) != n)
+        throw std::invalid_argument("Expected colors array shape (N,4) matching the shapes");
+    return holder.data();
+}
+
+SDL_FColor _itemColor(const uint8_t* colors, const size_t i, const SDL_FColor& fallback)
+{
+    if (!colors)
+        return fallback;
+
+    const uint8_t* rgba = colors + i * 4;
+    return {rgba[0] / 255.f, rgba[1] / 255.f, rgba[2] / 255.f, rgba[3] / 255.f};
+}
+
+SDL_FRect _pointBounds(const std::vector<SDL_FPoint>& points)
+{
+    if (points.empty())
+        return {0.f, 0.f, 0.f, 0.f};
+
+    float minX = points[0].x, minY = points[0].y;
+    float maxX = minX, maxY = minY;
+    for (const SDL_FPoint& point : points)
+    {
+        minX = std::min(minX, point.x);
+        minY = std::min(minY, point.y);
+        maxX = std::max(maxX, point.x);
+        maxY = std::max(maxY, point.y);
+    }
+    return {minX, minY, maxX - minX + 1.f, maxY - minY + 1.f};
 }
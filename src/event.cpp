@@ -2,6 +2,7 @@
 #include "Gamepad.hpp"
 #include "Key.hpp"
 #include "Mouse.hpp"
+#include "Renderer.hpp"
 #include "Window.hpp"
 #include "_globals.hpp"
 
@@ -72,6 +73,12 @@ std::vector<knEvent> poll()
         case SDL_EVENT_QUIT:
             window::close();
             break;
+        case SDL_EVENT_WINDOW_EXPOSED:
+        case SDL_EVENT_WINDOW_RESIZED:
+        case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+        case SDL_EVENT_WINDOW_RESTORED:
+            renderer::_invalidateScreen();
+            break;
         default:
             break;
         }
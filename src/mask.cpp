@@ -2,8 +2,19 @@
 #include "Math.hpp"
 #include "PixelArray.hpp"
 #include "Rect.hpp"
+#include "_parallel.hpp"
+#include "_simd.hpp"
 
+#include <algorithm>
+#include <bitset>
 #include <pybind11/stl.h>
+#include <stdexcept>
+
+static uint64_t _bitsAt(const uint64_t* row, int words, int start);
+static int _popcount(uint64_t word);
+static int _lowestBit(uint64_t word);
+static int _highestBit(uint64_t word);
+static void _packAlphaRow(const uint8_t* pixels, int width, uint8_t threshold, uint64_t* bits);
 
 namespace mask
 {
@@ -12,22 +23,57 @@ void _bind(py::module_& module)
     py::classh<Mask>(module, "Mask", R"doc(
 A collision mask for pixel-perfect collision detection.
 
-A Mask represents a 2D bitmap, typically used for precise collision detection based on 
-non-transparent pixels.
+A Mask represents a 2D bitmap, typically used for precise collision detection based on
+non-transparent pixels. Each row is stored as packed 64-bit words, so collision tests
+compare 64 pixels at a time.
+
+Offsets passed to the collision methods are the position of the other mask relative
+to this one.
     )doc")
+        .def(py::init<const Vec2&, bool>(), py::arg("size"), py::arg("filled") = false, R"doc(
+Create a mask of the given size.
+
+Args:
+    size (Vec2): The mask size as (width, height).
+    filled (bool, optional): Whether every pixel starts solid. Defaults to False.
+
+Raises:
+    ValueError: If the size is negative.
+        )doc")
         .def(py::init<const PixelArray&, uint8_t>(), py::arg("pixel_array"),
-             py::arg("threshold") = 0,
+             py::arg("threshold") = 1,
              R"doc(
 Create a mask from a pixel array based on alpha threshold.
 
 Args:
     pixel_array (PixelArray): The source pixel array to create the mask from.
-    threshold (int): Alpha threshold value (0-255). Pixels with alpha >= threshold are solid.
+    threshold (int, optional): Alpha threshold value (0-255). Pixels with alpha >= threshold
+                               are solid. Defaults to 1, so only fully transparent pixels
+                               are empty.
 
 Raises:
     RuntimeError: If the pixel array is invalid.
         )doc")
 
+        .def("copy", &Mask::copy, R"doc(
+Create a copy of this mask.
+
+Returns:
+    Mask: A new mask with the same size and pixels.
+        )doc")
+        .def("get_size", &Mask::getSize, R"doc(
+Get the size of the mask.
+
+Returns:
+    Vec2: The mask size as (width, height).
+        )doc")
+        .def("get_rect", &Mask::getRect, R"doc(
+Get a rectangle representing the mask bounds.
+
+Returns:
+    Rect: A rectangle with position (0, 0) and the mask's dimensions.
+        )doc")
+
         .def("collide_mask",
              py::overload_cast<const Mask&, const Vec2&>(&Mask::collideMask, py::const_),
              py::arg("other"), py::arg("offset"), R"doc(
@@ -35,11 +81,118 @@ Check collision between this mask and another mask with an offset.
 
 Args:
     other (Mask): The other mask to test collision with.
-    offset (Vec2): Position offset between the masks.
+    offset (Vec2): The position of the other mask relative to this one.
 
 Returns:
     bool: True if the masks collide, False otherwise.
         )doc")
+        .def("get_overlap_area", &Mask::getOverlapArea, py::arg("other"), py::arg("offset"),
+             R"doc(
+Count the solid pixels the two masks share.
+
+Args:
+    other (Mask): The other mask to test against.
+    offset (Vec2): The position of the other mask relative to this one.
+
+Returns:
+    int: The number of overlapping solid pixels.
+        )doc")
+        .def("get_overlap_mask", &Mask::getOverlapMask, py::arg("other"), py::arg("offset"),
+             R"doc(
+Get a mask of the solid pixels the two masks share.
+
+Args:
+    other (Mask): The other mask to test against.
+    offset (Vec2): The position of the other mask relative to this one.
+
+Returns:
+    Mask: A mask the size of this one, set where both masks are solid.
+        )doc")
+
+        .def("get_collision_points",
+             py::overload_cast<const Mask&, const Vec2&>(&Mask::getCollisionPoints, py::const_),
+             py::arg("other"), py::arg("offset"), R"doc(
+Get the positions of the solid pixels the two masks share.
+
+Args:
+    other (Mask): The other mask to test against.
+    offset (Vec2): The position of the other mask relative to this one.
+
+Returns:
+    list[Vec2]: The overlapping pixels in this mask's coordinates, in row order.
+        )doc")
+        .def("get_collision_points",
+             py::overload_cast<const Mask&, const Rect&, const Rect&>(&Mask::getCollisionPoints,
+                                                                      py::const_),
+             py::arg("other"), py::arg("rect_a"), py::arg("rect_b"), R"doc(
+Get the positions of the solid pixels the two masks share when placed at two rectangles.
+
+Args:
+    other (Mask): The other mask to test against.
+    rect_a (Rect): The rectangle this mask is drawn at. Only its position is used.
+    rect_b (Rect): The rectangle the other mask is drawn at. Only its position is used.
+
+Returns:
+    list[Vec2]: The overlapping pixels in the rectangles' coordinate space, in row order.
+        )doc")
+
+        .def("fill", &Mask::fill, R"doc(
+Set every pixel of the mask to solid.
+        )doc")
+        .def("clear", &Mask::clear, R"doc(
+Set every pixel of the mask to empty.
+        )doc")
+        .def("invert", &Mask::invert, R"doc(
+Flip every pixel of the mask between solid and empty.
+        )doc")
+        .def("add", &Mask::add, py::arg("other"), py::arg("offset"), R"doc(
+Make every pixel that is solid in another mask solid in this one.
+
+Args:
+    other (Mask): The mask to add.
+    offset (Vec2): The position of the other mask relative to this one.
+        )doc")
+        .def("subtract", &Mask::subtract, py::arg("other"), py::arg("offset"), R"doc(
+Make every pixel that is solid in another mask empty in this one.
+
+Args:
+    other (Mask): The mask to subtract.
+    offset (Vec2): The position of the other mask relative to this one.
+        )doc")
+
+        .def("get_count", &Mask::getCount, R"doc(
+Count the solid pixels in the mask.
+
+Returns:
+    int: The number of solid pixels.
+        )doc")
+        .def("get_center_of_mass", &Mask::getCenterOfMass, R"doc(
+Get the average position of the solid pixels.
+
+Returns:
+    Vec2: The center of mass, or (0, 0) if the mask is empty.
+        )doc")
+        .def("get_outline", &Mask::getOutline, R"doc(
+Trace the outline of the first solid shape in the mask.
+
+The shape is the one containing the topmost, then leftmost, solid pixel. Its border is
+followed clockwise using 8-connectivity.
+
+Returns:
+    list[Vec2]: The border pixels in tracing order, or an empty list if the mask is empty.
+        )doc")
+        .def("get_bounding_rect", &Mask::getBoundingRect, R"doc(
+Get the smallest rectangle containing every solid pixel.
+
+Returns:
+    Rect: The bounding rectangle, or a zero-size rectangle at (0, 0) if the mask is empty.
+        )doc")
+        .def("is_empty", &Mask::isEmpty, R"doc(
+Check whether the mask has no solid pixels.
+
+Returns:
+    bool: True if no pixel is solid, False otherwise.
+        )doc")
 
         .def("get_at", &Mask::getAt, py::arg("pos"), R"doc(
 Get the pixel value at a specific position.
@@ -50,6 +203,13 @@ Args:
 Returns:
     bool: True if the pixel is solid (above threshold), False otherwise.
         )doc")
+        .def("set_at", &Mask::setAt, py::arg("pos"), py::arg("value"), R"doc(
+Set the pixel value at a specific position. Positions outside the mask are ignored.
+
+Args:
+    pos (Vec2): The position to set.
+    value (bool): Whether the pixel is solid.
+        )doc")
 
         .def_property_readonly("width", &Mask::getWidth, R"doc(
 The width of the mask in pixels.
@@ -75,29 +235,41 @@ Check if the mask is valid (always True for existing masks).
 }
 } // namespace mask
 
-Mask::Mask(const Vec2& size, bool filled)
-    : m_width(static_cast<int>(size.x)), m_height(static_cast<int>(size.y)),
-      m_maskData(m_width * m_height, filled)
+Mask::Mask(const Vec2& size, const bool filled)
+    : m_width(static_cast<int>(size.x)), m_height(static_cast<int>(size.y))
 {
+    if (m_width < 0 || m_height < 0)
+        throw std::invalid_argument("Mask size cannot be negative");
+
+    m_stride = (m_width + 63) / 64;
+    m_words.assign(static_cast<size_t>(m_stride) * m_height, filled ? ~uint64_t{0} : 0);
+    clearPadding();
 }
 
 Mask::Mask(const PixelArray& pixelArray, const uint8_t threshold)
     : m_width(pixelArray.getWidth()), m_height(pixelArray.getHeight()),
-      m_maskData(m_width * m_height, false)
+      m_stride((m_width + 63) / 64), m_words(static_cast<size_t>(m_stride) * m_height, 0)
 {
     SDL_Surface* rawSurface = pixelArray.getSDL();
     if (!rawSurface)
         throw std::runtime_error("PixelArray object internal SDL surface pointer is null");
 
-    const auto* pixels = static_cast<uint8_t*>(rawSurface->pixels);
-    const int pitch = rawSurface->pitch;
+    SDL_Surface* surface = rawSurface;
+    if (surface->format != SDL_PIXELFORMAT_RGBA32 || SDL_SurfaceHasRLE(surface))
+        surface = pixel_array::_convertRGBA32(surface);
 
-    for (int y = 0; y < m_height; y++)
-        for (int x = 0; x < m_height; x++)
-        {
-            const uint8_t* pixel = pixels + y * pitch + x * 4;
-            m_maskData[y * m_width + x] = (pixel[3] >= threshold);
-        }
+    const auto* pixels = static_cast<const uint8_t*>(surface->pixels);
+    const int pitch = surface->pitch;
+
+    parallel::forRange(m_height, 64,
+                       [&](const int begin, const int end)
+                       {
+                           for (int y = begin; y < end; ++y)
+                               _packAlphaRow(pixels + y * pitch, m_width, threshold, row(y));
+                       });
+
+    if (surface != rawSurface)
+        SDL_DestroySurface(surface);
 }
 
 bool Mask::collideMask(const Mask& other, const Vec2& offset) const
@@ -105,39 +277,352 @@ bool Mask::collideMask(const Mask& other, const Vec2& offset) const
     const auto xOffset = static_cast<int>(offset.x);
     const auto yOffset = static_cast<int>(offset.y);
 
-    const int xStart = std::max(0, -xOffset);
-    const int yStart = std::max(0, -yOffset);
-    const int xEnd = std::min(m_width, other.m_width - xOffset);
-    const int yEnd = std::min(m_height, other.m_height - yOffset);
+    updateSummary();
+    other.updateSummary();
+    if (m_maxY < 0 || other.m_maxY < 0)
+        return false;
 
+    // Only the intersection of the two tight bounds can collide
+    const int xStart = std::max(m_minX, other.m_minX + xOffset);
+    const int yStart = std::max(m_minY, other.m_minY + yOffset);
+    const int xEnd = std::min(m_maxX, other.m_maxX + xOffset) + 1;
+    const int yEnd = std::min(m_maxY, other.m_maxY + yOffset) + 1;
     if (xStart >= xEnd || yStart >= yEnd)
-        return false; // No overlap
+        return false;
 
-    for (int y = yStart; y < yEnd; ++y)
-        for (int x = xStart; x < xEnd; ++x)
-            if (getAt({x, y}) && other.getAt({x + xOffset, y + yOffset}))
-                return true;
+    // Each block of the other mask straddles at most two of this mask's blocks per axis, so its
+    // occupancy is shifted by whole blocks and smeared one block right when misaligned
+    const int blockShift = xOffset >= 0 ? xOffset / 8 : -((7 - xOffset) / 8);
+    const bool misaligned = xOffset - blockShift * 8 != 0;
+    std::vector<uint64_t> otherBlocks(other.m_blockStride);
+
+    for (int by = yStart / 8; by <= (yEnd - 1) / 8; ++by)
+    {
+        const int rowBegin = std::max(yStart, by * 8);
+        const int rowEnd = std::min(yEnd, by * 8 + 8);
+
+        std::fill(otherBlocks.begin(), otherBlocks.end(), 0);
+        for (int otherBy = (rowBegin - yOffset) / 8; otherBy <= (rowEnd - 1 - yOffset) / 8;
+             ++otherBy)
+        {
+            const uint64_t* blocks = other.blockRow(otherBy);
+            for (int word = 0; word < other.m_blockStride; ++word)
+                otherBlocks[word] |= blocks[word];
+        }
+
+        const uint64_t* blocks = blockRow(by);
+        for (int blockWord = xStart / 512; blockWord <= (xEnd - 1) / 512; ++blockWord)
+        {
+            const int start = blockWord * 64 - blockShift;
+            uint64_t shared = _bitsAt(otherBlocks.data(), other.m_blockStride, start);
+            if (misaligned)
+                shared |= _bitsAt(otherBlocks.data(), other.m_blockStride, start - 1);
+
+            // Only blocks occupied in both masks are tested pixel by pixel
+            for (shared &= blocks[blockWord]; shared; shared &= shared - 1)
+            {
+                const int bx = blockWord * 64 + _lowestBit(shared);
+                const int word = bx / 8;
+                const uint64_t columns = uint64_t{0xFF} << (bx % 8 * 8);
+                for (int y = rowBegin; y < rowEnd; ++y)
+                {
+                    const uint64_t otherBits =
+                        _bitsAt(other.row(y - yOffset), other.m_stride, word * 64 - xOffset);
+                    if (row(y)[word] & columns & otherBits)
+                        return true;
+                }
+            }
+        }
+    }
 
     return false;
 }
 
+int Mask::getOverlapArea(const Mask& other, const Vec2& offset) const
+{
+    int area = 0;
+    forEachOverlap(other, static_cast<int>(offset.x), static_cast<int>(offset.y),
+                   [&area](int, int, const uint64_t bits, const uint64_t otherBits)
+                   {
+                       area += _popcount(bits & otherBits);
+                       return true;
+                   });
+    return area;
+}
+
+Mask Mask::getOverlapMask(const Mask& other, const Vec2& offset) const
+{
+    Mask overlap(getSize());
+    forEachOverlap(other, static_cast<int>(offset.x), static_cast<int>(offset.y),
+                   [&overlap](const int y, const int word, const uint64_t bits,
+                              const uint64_t otherBits)
+                   {
+                       overlap.row(y)[word] = bits & otherBits;
+                       return true;
+                   });
+    return overlap;
+}
+
+std::vector<Vec2> Mask::getCollisionPoints(const Mask& other, const Vec2& offset) const
+{
+    std::vector<Vec2> points;
+    forEachOverlap(other, static_cast<int>(offset.x), static_cast<int>(offset.y),
+                   [&points](const int y, const int word, const uint64_t bits,
+                             const uint64_t otherBits)
+                   {
+                       for (uint64_t hits = bits & otherBits; hits; hits &= hits - 1)
+                           points.emplace_back(word * 64 + _lowestBit(hits), y);
+                       return true;
+                   });
+    return points;
+}
+
+std::vector<Vec2> Mask::getCollisionPoints(const Mask& other, const Rect& rectA,
+                                           const Rect& rectB) const
+{
+    const auto xA = static_cast<int>(rectA.x);
+    const auto yA = static_cast<int>(rectA.y);
+    const Vec2 offset(static_cast<int>(rectB.x) - xA, static_cast<int>(rectB.y) - yA);
+
+    std::vector<Vec2> points = getCollisionPoints(other, offset);
+    for (Vec2& point : points)
+    {
+        point.x += xA;
+        point.y += yA;
+    }
+    return points;
+}
+
+void Mask::fill()
+{
+    m_summaryDirty = true;
+    std::fill(m_words.begin(), m_words.end(), ~uint64_t{0});
+    clearPadding();
+}
+
+void Mask::clear()
+{
+    std::fill(m_words.begin(), m_words.end(), 0);
+    m_summaryDirty = true;
+}
+
+void Mask::invert()
+{
+    m_summaryDirty = true;
+    for (uint64_t& word : m_words)
+        word = ~word;
+    clearPadding();
+}
+
+void Mask::add(const Mask& other, const Vec2& offset)
+{
+    // Rows are rewritten while the other mask is read, so a mask cannot be its own source
+    if (&other == this)
+    {
+        add(copy(), offset);
+        return;
+    }
+
+    forEachOverlap(other, static_cast<int>(offset.x), static_cast<int>(offset.y),
+                   [this](const int y, const int word, const uint64_t bits,
+                          const uint64_t otherBits)
+                   {
+                       row(y)[word] = bits | otherBits;
+                       return true;
+                   });
+    m_summaryDirty = true;
+}
+
+void Mask::subtract(const Mask& other, const Vec2& offset)
+{
+    // Rows are rewritten while the other mask is read, so a mask cannot be its own source
+    if (&other == this)
+    {
+        subtract(copy(), offset);
+        return;
+    }
+
+    forEachOverlap(other, static_cast<int>(offset.x), static_cast<int>(offset.y),
+                   [this](const int y, const int word, const uint64_t bits,
+                          const uint64_t otherBits)
+                   {
+                       row(y)[word] = bits & ~otherBits;
+                       return true;
+                   });
+    m_summaryDirty = true;
+}
+
+int Mask::getCount() const
+{
+    int count = 0;
+    for (const uint64_t word : m_words)
+        count += _popcount(word);
+    return count;
+}
+
+Vec2 Mask::getCenterOfMass() const
+{
+    double sumX = 0.0;
+    double sumY = 0.0;
+    int count = 0;
+    for (int y = 0; y < m_height; ++y)
+    {
+        const uint64_t* bits = row(y);
+        int rowCount = 0;
+        for (int word = 0; word < m_stride; ++word)
+        {
+            for (uint64_t rest = bits[word]; rest; rest &= rest - 1)
+            {
+                sumX += word * 64 + _lowestBit(rest);
+                ++rowCount;
+            }
+        }
+        sumY += static_cast<double>(y) * rowCount;
+        count += rowCount;
+    }
+
+    if (count == 0)
+        return {};
+    return {sumX / count, sumY / count};
+}
+
+std::vector<Vec2> Mask::getOutline() const
+{
+    // Neighbor directions in clockwise order, starting east
+    static constexpr int dx[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+    static constexpr int dy[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+
+    const auto solid = [this](const int x, const int y)
+    {
+        return x >= 0 && y >= 0 && x < m_width && y < m_height &&
+               ((row(y)[x / 64] >> (x % 64)) & 1);
+    };
+
+    std::vector<Vec2> outline;
+    int startX = -1;
+    int startY = -1;
+    for (int y = 0; y < m_height && startY < 0; ++y)
+    {
+        const uint64_t* bits = row(y);
+        for (int word = 0; word < m_stride; ++word)
+        {
+            if (bits[word])
+            {
+                startX = word * 64 + _lowestBit(bits[word]);
+                startY = y;
+                break;
+            }
+        }
+    }
+    if (startY < 0)
+        return outline;
+
+    outline.emplace_back(startX, startY);
+
+    // Moore neighbor tracing. The start is the first solid pixel in row order, so the pixel
+    // to its west is empty and the search around it begins there
+    int x = startX;
+    int y = startY;
+    int back = 4;
+    int secondX = -1;
+    int secondY = -1;
+    const long long maxSteps = 4LL * m_width * m_height + 8;
+    for (long long step = 0; step < maxSteps; ++step)
+    {
+        int dir = -1;
+        for (int i = 1; i <= 8; ++i)
+        {
+            const int d = (back + i) % 8;
+            if (solid(x + dx[d], y + dy[d]))
+            {
+                dir = d;
+                break;
+            }
+        }
+        if (dir < 0)
+            break; // An isolated pixel
+
+        const int nextX = x + dx[dir];
+        const int nextY = y + dy[dir];
+
+        // Stop once the trace leaves the start the same way it did the first time. Passing
+        // through the start any other way adds it again, keeping the points connected
+        if (x == startX && y == startY)
+        {
+            if (nextX == secondX && nextY == secondY)
+                break;
+            if (secondY < 0)
+            {
+                secondX = nextX;
+                secondY = nextY;
+            }
+            else
+            {
+                outline.emplace_back(x, y);
+            }
+        }
+
+        // Resume the search from the last empty neighbor checked, as seen from the new pixel
+        const int emptyX = x + dx[(dir + 7) % 8] - nextX;
+        const int emptyY = y + dy[(dir + 7) % 8] - nextY;
+        for (int d = 0; d < 8; ++d)
+        {
+            if (dx[d] == emptyX && dy[d] == emptyY)
+            {
+                back = d;
+                break;
+            }
+        }
+
+        x = nextX;
+        y = nextY;
+        if (x != startX || y != startY)
+            outline.emplace_back(x, y);
+    }
+
+    return outline;
+}
+
+Rect Mask::getBoundingRect() const
+{
+    updateSummary();
+    if (m_maxY < 0)
+        return {};
+    return {static_cast<double>(m_minX), static_cast<double>(m_minY),
+            static_cast<double>(m_maxX - m_minX + 1), static_cast<double>(m_maxY - m_minY + 1)};
+}
+
+bool Mask::isEmpty() const
+{
+    updateSummary();
+    return m_maxY < 0;
+}
+
 bool Mask::getAt(const Vec2& pos) const
 {
     if (pos.x < 0 || pos.x >= m_width || pos.y < 0 || pos.y >= m_height)
         return false;
 
-    return m_maskData[pos.y * m_width + pos.x];
+    const auto x = static_cast<int>(pos.x);
+    return (row(static_cast<int>(pos.y))[x / 64] >> (x % 64)) & 1;
 }
 
-void Mask::setAt(const Vec2& pos, bool value)
+void Mask::setAt(const Vec2& pos, const bool value)
 {
     if (pos.x < 0 || pos.x >= m_width || pos.y < 0 || pos.y >= m_height)
         return;
 
-    m_maskData[pos.y * m_width + pos.x] = value;
+    const auto x = static_cast<int>(pos.x);
+    const uint64_t bit = uint64_t{1} << (x % 64);
+    uint64_t& word = row(static_cast<int>(pos.y))[x / 64];
+    word = value ? word | bit : word & ~bit;
+    m_summaryDirty = true;
 }
 
-Rect Mask::getRect() const { return {0, 0, m_width, m_height}; }
+Rect Mask::getRect() const
+{
+    return {0.0, 0.0, static_cast<double>(m_width), static_cast<double>(m_height)};
+}
 
 int Mask::getWidth() const { return m_width; }
 
@@ -145,11 +630,205 @@ int Mask::getHeight() const { return m_height; }
 
 Vec2 Mask::getSize() const { return {m_width, m_height}; }
 
-Mask Mask::copy() const
+Mask Mask::copy() const { return *this; }
+
+const uint64_t* Mask::row(const int y) const
+{
+    return m_words.data() + static_cast<size_t>(y) * m_stride;
+}
+
+uint64_t* Mask::row(const int y) { return m_words.data() + static_cast<size_t>(y) * m_stride; }
+
+const uint64_t* Mask::blockRow(const int by) const
 {
-    Mask copy;
-    copy.m_width = m_width;
-    copy.m_height = m_height;
-    copy.m_maskData = m_maskData;
-    return copy;
-}
\ No newline at end of file
+    return m_blocks.data() + static_cast<size_t>(by) * m_blockStride;
+}
+
+void Mask::updateSummary() const
+{
+    if (!m_summaryDirty)
+        return;
+
+    const int blockRows = (m_height + 7) / 8;
+    m_blockStride = ((m_width + 7) / 8 + 63) / 64;
+    m_blocks.assign(static_cast<size_t>(m_blockStride) * blockRows, 0);
+    m_minX = m_width;
+    m_minY = m_height;
+    m_maxX = -1;
+    m_maxY = -1;
+
+    std::vector<uint64_t> band(m_stride);
+    for (int by = 0; by < blockRows; ++by)
+    {
+        std::fill(band.begin(), band.end(), 0);
+        for (int y = by * 8; y < std::min(m_height, by * 8 + 8); ++y)
+        {
+            const uint64_t* bits = row(y);
+            for (int word = 0; word < m_stride; ++word)
+            {
+                if (!bits[word])
+                    continue;
+                band[word] |= bits[word];
+                m_minX = std::min(m_minX, word * 64 + _lowestBit(bits[word]));
+                m_maxX = std::max(m_maxX, word * 64 + _highestBit(bits[word]));
+                m_minY = std::min(m_minY, y);
+                m_maxY = y;
+            }
+        }
+
+        // Collapse each byte of the band to one bit, then gather the eight bits with a multiply
+        auto* blocks = m_blocks.data() + static_cast<size_t>(by) * m_blockStride;
+        for (int word = 0; word < m_stride; ++word)
+        {
+            uint64_t any = band[word];
+            any |= any >> 4;
+            any |= any >> 2;
+            any |= any >> 1;
+            const uint64_t occupied = ((any & 0x0101010101010101ULL) * 0x0102040810204080ULL) >> 56;
+            blocks[word / 8] |= occupied << (word % 8 * 8);
+        }
+    }
+
+    if (m_maxY < 0)
+    {
+        m_minX = 0;
+        m_minY = 0;
+    }
+    m_summaryDirty = false;
+}
+
+void Mask::clearPadding()
+{
+    if (m_width % 64 == 0)
+        return;
+
+    const uint64_t keep = (uint64_t{1} << (m_width % 64)) - 1;
+    for (int y = 0; y < m_height; ++y)
+        row(y)[m_stride - 1] &= keep;
+}
+
+template <typename Fn>
+void Mask::forEachOverlap(const Mask& other, const int xOffset, const int yOffset, Fn&& fn) const
+{
+    // The other mask is empty outside its tight bounds, so nothing there can change the result
+    other.updateSummary();
+    const int xStart = std::max(0, other.m_minX + xOffset);
+    const int yStart = std::max(0, other.m_minY + yOffset);
+    const int xEnd = std::min(m_width, other.m_maxX + 1 + xOffset);
+    const int yEnd = std::min(m_height, other.m_maxY + 1 + yOffset);
+
+    if (xStart >= xEnd || yStart >= yEnd)
+        return; // No overlap
+
+    // Bits of the other mask outside its width read as zero, and bits past this mask's width
+    // are cleared, so whole words can be combined without touching the padding
+    const int firstWord = xStart / 64;
+    const int lastWord = (xEnd - 1) / 64;
+    const uint64_t lastKeep = m_width % 64 ? (uint64_t{1} << (m_width % 64)) - 1 : ~uint64_t{0};
+    for (int y = yStart; y < yEnd; ++y)
+    {
+        const uint64_t* bits = row(y);
+        const uint64_t* otherBits = other.row(y - yOffset);
+        for (int word = firstWord; word <= lastWord; ++word)
+        {
+            uint64_t shifted = _bitsAt(otherBits, other.m_stride, word * 64 - xOffset);
+            if (word == m_stride - 1)
+                shifted &= lastKeep;
+            if (!fn(y, word, bits[word], shifted))
+                return;
+        }
+    }
+}
+
+// The 64 bits of a mask row starting at bit position start, which may be negative or run
+// past the end of the row. Bits outside the row are zero
+uint64_t _bitsAt(const uint64_t* row, const int words, const int start)
+{
+    const int word = start >= 0 ? start / 64 : -((63 - start) / 64);
+    const int shift = start - word * 64;
+
+    const uint64_t low = word >= 0 && word < words ? row[word] : 0;
+    if (shift == 0)
+        return low;
+
+    const uint64_t high = word + 1 >= 0 && word + 1 < words ? row[word + 1] : 0;
+    return (low >> shift) | (high << (64 - shift));
+}
+
+int _popcount(const uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    return static_cast<int>(std::bitset<64>(word).count());
+#endif
+}
+
+int _lowestBit(const uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while (!((word >> bit) & 1))
+        ++bit;
+    return bit;
+#endif
+}
+
+int _highestBit(const uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(word);
+#else
+    int bit = 63;
+    while (!((word >> bit) & 1))
+        --bit;
+    return bit;
+#endif
+}
+
+// Set bit x of the row for every RGBA32 pixel x whose alpha is at least the threshold,
+// comparing 16 pixels at a time. The row's bits must start cleared
+void _packAlphaRow(const uint8_t* pixels, const int width, const uint8_t threshold,
+                   uint64_t* bits)
+{
+    int x = 0;
+#if defined(KN_SIMD_SSE2)
+    // Alpha is the top byte of each little-endian pixel, so it can be compared as an int
+    const __m128i below = _mm_set1_epi32(static_cast<int>(threshold) - 1);
+    for (; x + 16 <= width; x += 16)
+    {
+        const auto* src = reinterpret_cast<const __m128i*>(pixels + x * 4);
+        const __m128i a = _mm_cmpgt_epi32(_mm_srli_epi32(_mm_loadu_si128(src), 24), below);
+        const __m128i b = _mm_cmpgt_epi32(_mm_srli_epi32(_mm_loadu_si128(src + 1), 24), below);
+        const __m128i c = _mm_cmpgt_epi32(_mm_srli_epi32(_mm_loadu_si128(src + 2), 24), below);
+        const __m128i d = _mm_cmpgt_epi32(_mm_srli_epi32(_mm_loadu_si128(src + 3), 24), below);
+        const __m128i packed = _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        const auto solid = static_cast<uint64_t>(_mm_movemask_epi8(packed));
+        bits[x / 64] |= solid << (x % 64);
+    }
+#elif defined(KN_SIMD_NEON)
+    static const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                        1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t weight = vld1q_u8(weights);
+    const uint8x16_t level = vdupq_n_u8(threshold);
+    for (; x + 16 <= width; x += 16)
+    {
+        const uint8x16x4_t channels = vld4q_u8(pixels + x * 4);
+        const uint8x16_t solid = vandq_u8(vcgeq_u8(channels.val[3], level), weight);
+
+        // Sum each half's weighted lanes into one byte per eight pixels
+        uint8x8_t sum = vpadd_u8(vget_low_u8(solid), vget_high_u8(solid));
+        sum = vpadd_u8(sum, sum);
+        sum = vpadd_u8(sum, sum);
+        const uint64_t packed = vget_lane_u8(sum, 0) | (vget_lane_u8(sum, 1) << 8);
+        bits[x / 64] |= packed << (x % 64);
+    }
+#endif
+    for (; x < width; ++x)
+    {
+        if (pixels[x * 4 + 3] >= threshold)
+            bits[x / 64] |= uint64_t{1} << (x % 64);
+    }
+}
@@ -2,8 +2,21 @@
 #include "Math.hpp"
 #include "PixelArray.hpp"
 #include "Rect.hpp"
+#include "_simd.hpp"
 
 #include <SDL3_image/SDL_image.h>
+#include <cstring>
+
+static void _swizzleRow(const uint32_t* src, uint32_t* dst, int width,
+                        const SDL_PixelFormatDetails& from, const SDL_PixelFormatDetails& to);
+static void _expandRow(const uint8_t* src, uint32_t* dst, int width, bool bgr,
+                       const SDL_PixelFormatDetails& to);
+static int _getBuffer(PyObject* self, Py_buffer* view, int flags);
+static void _releaseBuffer(PyObject* self, Py_buffer* view);
+
+// pybind11's own buffer slots for PixelArray, which _getBuffer and _releaseBuffer wrap
+static getbufferproc _baseGetBuffer = nullptr;
+static releasebufferproc _baseReleaseBuffer = nullptr;
 
 namespace pixel_array
 {
@@ -16,13 +29,19 @@ void _bind(py::module_& module)
     //     .export_values()
     //     .finalize();
 
-    py::classh<PixelArray>(module, "PixelArray", R"doc(
+    py::classh<PixelArray>(module, "PixelArray", py::buffer_protocol(), R"doc(
 Represents a 2D pixel buffer for image manipulation and blitting operations.
 
 A PixelArray is a 2D array of pixels that can be manipulated, drawn on, and used as a source
 for texture creation or blitting to other PixelArrays. Supports pixel-level operations,
 color key transparency, and alpha blending.
+
+PixelArray supports the buffer protocol: ``numpy.asarray(pixel_array)`` returns a writable
+(height, width, 4) uint8 RGBA view of the pixels without copying. Exporting a view converts
+the pixel array to the RGBA32 format if it uses another format. While any view is alive,
+writing a transform result of a different size into the pixel array raises BufferError.
     )doc")
+        .def_buffer(&PixelArray::getBuffer)
         .def(py::init<const Vec2&>(), py::arg("size"), R"doc(
 Create a new PixelArray with the specified dimensions.
 
@@ -32,16 +51,43 @@ Args:
 Raises:
     RuntimeError: If pixel array creation fails.
         )doc")
-        .def(py::init<const std::string&>(), py::arg("file_path"), R"doc(
+        .def(py::init<const std::string&, bool>(), py::arg("file_path"),
+             py::arg("premultiplied") = false, R"doc(
 Create a PixelArray by loading an image from a file.
 
+The pixels are converted to the RGBA32 format on load.
+
 Args:
     file_path (str): Path to the image file to load.
+    premultiplied (bool, optional): Whether to multiply the color channels by alpha on load.
+                                    Textures created from a premultiplied pixel array blend
+                                    accordingly. Defaults to False.
 
 Raises:
     RuntimeError: If the file cannot be loaded or doesn't exist.
         )doc")
 
+        .def_static("from_numpy", &PixelArray::fromNumpy, py::arg("array"),
+                    py::arg("copy") = false, R"doc(
+Create a PixelArray from a NumPy array of RGBA pixels.
+
+Without copying, the pixel array shares memory with the given array and keeps it alive,
+so changes to either are visible in both.
+
+Args:
+    array (numpy.ndarray): Array with shape (height, width, 4) and dtype uint8.
+    copy (bool, optional): Whether to copy the pixels instead of sharing the array's memory.
+                           Defaults to False.
+
+Returns:
+    PixelArray: The new pixel array.
+
+Raises:
+    ValueError: If the array shape or dtype is invalid, or if copy is False and the array
+                is not writable or its rows are not contiguous RGBA pixels.
+    RuntimeError: If pixel array creation fails.
+        )doc")
+
         .def("fill", &PixelArray::fill, py::arg("color"), R"doc(
 Fill the entire pixel array with a solid color.
 
@@ -158,7 +204,127 @@ A rectangle representing the pixel array bounds.
 
 Returns:
     Rect: A rectangle with position (0, 0) and the pixel array's dimensions.
+        )doc")
+        .def_property_readonly("premultiplied", &PixelArray::isPremultiplied, R"doc(
+Whether the color channels are premultiplied by alpha.
         )doc");
+
+    // Wrap pybind11's buffer slots to count the views that are alive, so the pixels are never
+    // swapped out from under one
+    auto* type = reinterpret_cast<PyTypeObject*>(module.attr("PixelArray").ptr());
+    _baseGetBuffer = type->tp_as_buffer->bf_getbuffer;
+    _baseReleaseBuffer = type->tp_as_buffer->bf_releasebuffer;
+    type->tp_as_buffer->bf_getbuffer = _getBuffer;
+    type->tp_as_buffer->bf_releasebuffer = _releaseBuffer;
+}
+
+SDL_Surface* _convertRGBA32(SDL_Surface* surface)
+{
+    const SDL_PixelFormatDetails* details = SDL_GetPixelFormatDetails(surface->format);
+    const bool packed32 = details && details->bytes_per_pixel == 4 && details->Rbits == 8 &&
+                          details->Gbits == 8 && details->Bbits == 8 &&
+                          (details->Abits == 8 || details->Abits == 0);
+    const bool packed24 =
+        surface->format == SDL_PIXELFORMAT_RGB24 || surface->format == SDL_PIXELFORMAT_BGR24;
+
+    // Palettes, color keys and RLE need SDL's general converter
+    if ((!packed32 && !packed24) || SDL_SurfaceHasColorKey(surface) || SDL_SurfaceHasRLE(surface))
+    {
+        SDL_Surface* converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+        if (!converted)
+            throw std::runtime_error("Failed to convert pixel array to RGBA32: " +
+                                     std::string(SDL_GetError()));
+        return converted;
+    }
+
+    SDL_Surface* converted = SDL_CreateSurface(surface->w, surface->h, SDL_PIXELFORMAT_RGBA32);
+    if (!converted)
+        throw std::runtime_error("Failed to convert pixel array to RGBA32: " +
+                                 std::string(SDL_GetError()));
+
+    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+    Uint8 alpha = 255, r = 255, g = 255, b = 255;
+    SDL_GetSurfaceBlendMode(surface, &blendMode);
+    SDL_GetSurfaceAlphaMod(surface, &alpha);
+    SDL_GetSurfaceColorMod(surface, &r, &g, &b);
+    SDL_SetSurfaceBlendMode(converted, blendMode);
+    SDL_SetSurfaceAlphaMod(converted, alpha);
+    SDL_SetSurfaceColorMod(converted, r, g, b);
+
+    const auto* dstDetails = SDL_GetPixelFormatDetails(SDL_PIXELFORMAT_RGBA32);
+    for (int y = 0; y < surface->h; ++y)
+    {
+        const auto* srcRow = static_cast<const uint8_t*>(surface->pixels) + y * surface->pitch;
+        auto* dstRow = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(converted->pixels) +
+                                                   y * converted->pitch);
+        if (packed32)
+            _swizzleRow(reinterpret_cast<const uint32_t*>(srcRow), dstRow, surface->w, *details,
+                        *dstDetails);
+        else
+            _expandRow(srcRow, dstRow, surface->w, surface->format == SDL_PIXELFORMAT_BGR24,
+                       *dstDetails);
+    }
+
+    return converted;
+}
+
+void _premultiply(SDL_Surface* surface)
+{
+    const int width = surface->w;
+    for (int y = 0; y < surface->h; ++y)
+    {
+        auto* row = static_cast<uint8_t*>(surface->pixels) + y * surface->pitch;
+        int x = 0;
+
+#if defined(KN_SIMD_SSE2)
+        // c * a / 255 rounded, as ((t + (t >> 8)) >> 8) with t = c * a + 128, on 16-bit lanes
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i half = _mm_set1_epi16(128);
+        const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+        for (; x + 4 <= width; x += 4)
+        {
+            uint8_t* p = row + x * 4;
+            const __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+            __m128i lo = _mm_unpacklo_epi8(px, zero);
+            __m128i hi = _mm_unpackhi_epi8(px, zero);
+            const __m128i alphaLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, 0xFF), 0xFF);
+            const __m128i alphaHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, 0xFF), 0xFF);
+
+            lo = _mm_add_epi16(_mm_mullo_epi16(lo, alphaLo), half);
+            hi = _mm_add_epi16(_mm_mullo_epi16(hi, alphaHi), half);
+            lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+            hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+            const __m128i result = _mm_packus_epi16(lo, hi);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p),
+                             _mm_or_si128(_mm_andnot_si128(alphaMask, result),
+                                          _mm_and_si128(alphaMask, px)));
+        }
+#elif defined(KN_SIMD_NEON)
+        for (; x + 8 <= width; x += 8)
+        {
+            uint8_t* p = row + x * 4;
+            uint8x8x4_t px = vld4_u8(p);
+            for (int c = 0; c < 3; ++c)
+            {
+                const uint16x8_t t = vmull_u8(px.val[c], px.val[3]);
+                px.val[c] = vraddhn_u16(t, vrshrq_n_u16(t, 8));
+            }
+            vst4_u8(p, px);
+        }
+#endif
+
+        for (; x < width; ++x)
+        {
+            uint8_t* p = row + x * 4;
+            for (int c = 0; c < 3; ++c)
+            {
+                const int t = p[c] * p[3] + 128;
+                p[c] = static_cast<uint8_t>((t + (t >> 8)) >> 8);
+            }
+        }
+    }
 }
 } // namespace pixel_array
 
@@ -179,7 +345,7 @@ PixelArray::PixelArray(const Vec2& size)
         throw std::runtime_error("PixelArray failed to create: " + std::string(SDL_GetError()));
 }
 
-PixelArray::PixelArray(const std::string& filePath)
+PixelArray::PixelArray(const std::string& filePath, const bool premultiplied)
 {
     if (m_surface)
     {
@@ -187,10 +353,35 @@ PixelArray::PixelArray(const std::string& filePath)
         m_surface = nullptr;
     }
 
-    m_surface = IMG_Load(filePath.c_str());
-    if (!m_surface)
+    SDL_Surface* loaded = IMG_Load(filePath.c_str());
+    if (!loaded)
         throw std::runtime_error("Failed to load pixel array from file '" + filePath +
                                  "': " + std::string(SDL_GetError()));
+
+    // Normalize once so every pixel kernel can assume RGBA32
+    if (loaded->format == SDL_PIXELFORMAT_RGBA32 && !SDL_SurfaceHasRLE(loaded))
+    {
+        m_surface = loaded;
+    }
+    else
+    {
+        try
+        {
+            m_surface = pixel_array::_convertRGBA32(loaded);
+        }
+        catch (...)
+        {
+            SDL_DestroySurface(loaded);
+            throw;
+        }
+        SDL_DestroySurface(loaded);
+    }
+
+    if (premultiplied)
+    {
+        pixel_array::_premultiply(m_surface);
+        m_premultiplied = true;
+    }
 }
 
 PixelArray::~PixelArray()
@@ -202,6 +393,53 @@ PixelArray::~PixelArray()
     }
 }
 
+std::unique_ptr<PixelArray> PixelArray::fromNumpy(py::array arr, const bool copy)
+{
+    if (arr.ndim() != 3 || arr.shape(2) != 4)
+        throw std::invalid_argument("Expected array shape (height, width, 4)");
+    if (!py::isinstance<py::array_t<uint8_t>>(arr))
+        throw std::invalid_argument("Expected array dtype uint8");
+
+    const auto height = static_cast<int>(arr.shape(0));
+    const auto width = static_cast<int>(arr.shape(1));
+    if (width <= 0 || height <= 0)
+        throw std::invalid_argument("Array must not be empty");
+
+    auto pixelArray = std::make_unique<PixelArray>();
+    if (copy)
+    {
+        const auto contiguous =
+            py::array_t<uint8_t, py::array::c_style | py::array::forcecast>::ensure(arr);
+        pixelArray->m_surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+        if (!pixelArray->m_surface)
+            throw std::runtime_error("PixelArray failed to create: " +
+                                     std::string(SDL_GetError()));
+
+        const auto* src = contiguous.data();
+        auto* dst = static_cast<uint8_t*>(pixelArray->m_surface->pixels);
+        const size_t rowBytes = static_cast<size_t>(width) * 4;
+        for (int y = 0; y < height; ++y)
+            std::memcpy(dst + static_cast<size_t>(y) * pixelArray->m_surface->pitch,
+                        src + y * rowBytes, rowBytes);
+        return pixelArray;
+    }
+
+    // Sharing memory requires tightly packed RGBA pixels; rows may be padded
+    if (arr.strides(2) != 1 || arr.strides(1) != 4 || arr.strides(0) < width * 4)
+        throw std::invalid_argument("Array rows must be contiguous RGBA pixels to share memory");
+    if (!arr.writeable())
+        throw std::invalid_argument("Array must be writable to share memory");
+
+    pixelArray->m_surface =
+        SDL_CreateSurfaceFrom(width, height, SDL_PIXELFORMAT_RGBA32, arr.mutable_data(),
+                              static_cast<int>(arr.strides(0)));
+    if (!pixelArray->m_surface)
+        throw std::runtime_error("PixelArray failed to create: " + std::string(SDL_GetError()));
+
+    pixelArray->m_owner = std::move(arr);
+    return pixelArray;
+}
+
 void PixelArray::fill(const Color& color) const
 {
     auto colorMap = SDL_MapSurfaceRGBA(m_surface, color.r, color.g, color.b, color.a);
@@ -377,7 +615,148 @@ std::unique_ptr<PixelArray> PixelArray::copy() const
 
     auto copy = std::make_unique<PixelArray>();
     copy->m_surface = surfaceCopy;
+    copy->m_premultiplied = m_premultiplied;
     return copy;
 }
 
 SDL_Surface* PixelArray::getSDL() const { return m_surface; }
+
+bool PixelArray::isPremultiplied() const { return m_premultiplied; }
+
+void PixelArray::setPremultiplied(const bool premultiplied) { m_premultiplied = premultiplied; }
+
+bool PixelArray::isExported() const { return m_exports > 0; }
+
+void PixelArray::_addExport() { ++m_exports; }
+
+void PixelArray::_removeExport() { --m_exports; }
+
+SDL_Surface* PixelArray::replaceSDL(SDL_Surface* sdlSurface)
+{
+    if (m_exports > 0)
+        throw py::buffer_error("Cannot replace the pixels of a pixel array while a buffer view "
+                               "of it is alive");
+
+    SDL_Surface* previous = m_surface;
+    m_surface = sdlSurface;
+
+    if (m_owner)
+    {
+        // The previous pixels belong to a NumPy array, so only the wrapper can be released
+        SDL_DestroySurface(previous);
+        m_owner = py::object();
+        return nullptr;
+    }
+
+    return previous;
+}
+
+py::buffer_info PixelArray::getBuffer()
+{
+    if (m_surface->format != SDL_PIXELFORMAT_RGBA32)
+    {
+        SDL_Surface* converted = pixel_array::_convertRGBA32(m_surface);
+
+        SDL_DestroySurface(m_surface);
+        m_surface = converted;
+        m_owner = py::object();
+    }
+
+    // RLE-encoded surfaces keep their pixels in a private format and must stay decoded
+    SDL_SetSurfaceRLE(m_surface, false);
+
+    return py::buffer_info(
+        m_surface->pixels, sizeof(uint8_t), py::format_descriptor<uint8_t>::format(), 3,
+        {static_cast<py::ssize_t>(m_surface->h), static_cast<py::ssize_t>(m_surface->w),
+         static_cast<py::ssize_t>(4)},
+        {static_cast<py::ssize_t>(m_surface->pitch), static_cast<py::ssize_t>(4),
+         static_cast<py::ssize_t>(1)});
+}
+
+int _getBuffer(PyObject* self, Py_buffer* view, const int flags)
+{
+    const int result = _baseGetBuffer(self, view, flags);
+    if (result == 0)
+        py::handle(self).cast<PixelArray&>()._addExport();
+    return result;
+}
+
+void _releaseBuffer(PyObject* self, Py_buffer* view)
+{
+    py::handle(self).cast<PixelArray&>()._removeExport();
+    _baseReleaseBuffer(self, view);
+}
+
+// Repack a row of 8-bit-per-channel 32-bit pixels into RGBA32 using the formats' channel shifts
+void _swizzleRow(const uint32_t* src, uint32_t* dst, const int width,
+                 const SDL_PixelFormatDetails& from, const SDL_PixelFormatDetails& to)
+{
+    const bool hasAlpha = from.Abits != 0;
+    const uint32_t opaque = hasAlpha ? 0u : 0xFFu << to.Ashift;
+    int x = 0;
+
+#if defined(KN_SIMD_SSE2)
+    const __m128i byteMask = _mm_set1_epi32(0xFF);
+    const __m128i fill = _mm_set1_epi32(static_cast<int>(opaque));
+    const __m128i fromShifts[4] = {_mm_cvtsi32_si128(from.Rshift), _mm_cvtsi32_si128(from.Gshift),
+                                   _mm_cvtsi32_si128(from.Bshift), _mm_cvtsi32_si128(from.Ashift)};
+    const __m128i toShifts[4] = {_mm_cvtsi32_si128(to.Rshift), _mm_cvtsi32_si128(to.Gshift),
+                                 _mm_cvtsi32_si128(to.Bshift), _mm_cvtsi32_si128(to.Ashift)};
+    const int channels = hasAlpha ? 4 : 3;
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        __m128i out = fill;
+        for (int c = 0; c < channels; ++c)
+            out = _mm_or_si128(
+                out, _mm_sll_epi32(_mm_and_si128(_mm_srl_epi32(px, fromShifts[c]), byteMask),
+                                   toShifts[c]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), out);
+    }
+#elif defined(KN_SIMD_NEON)
+    const uint32x4_t byteMask = vdupq_n_u32(0xFF);
+    const uint32x4_t fill = vdupq_n_u32(opaque);
+    const int32x4_t fromShifts[4] = {vdupq_n_s32(-from.Rshift), vdupq_n_s32(-from.Gshift),
+                                     vdupq_n_s32(-from.Bshift), vdupq_n_s32(-from.Ashift)};
+    const int32x4_t toShifts[4] = {vdupq_n_s32(to.Rshift), vdupq_n_s32(to.Gshift),
+                                   vdupq_n_s32(to.Bshift), vdupq_n_s32(to.Ashift)};
+    const int channels = hasAlpha ? 4 : 3;
+    for (; x + 4 <= width; x += 4)
+    {
+        const uint32x4_t px = vld1q_u32(src + x);
+        uint32x4_t out = fill;
+        for (int c = 0; c < channels; ++c)
+            out = vorrq_u32(
+                out, vshlq_u32(vandq_u32(vshlq_u32(px, fromShifts[c]), byteMask), toShifts[c]));
+        vst1q_u32(dst + x, out);
+    }
+#endif
+
+    for (; x < width; ++x)
+    {
+        const uint32_t px = src[x];
+        uint32_t out = opaque;
+        out |= ((px >> from.Rshift) & 0xFF) << to.Rshift;
+        out |= ((px >> from.Gshift) & 0xFF) << to.Gshift;
+        out |= ((px >> from.Bshift) & 0xFF) << to.Bshift;
+        if (hasAlpha)
+            out |= ((px >> from.Ashift) & 0xFF) << to.Ashift;
+        dst[x] = out;
+    }
+}
+
+// Expand a row of RGB24 or BGR24 pixels into opaque RGBA32
+void _expandRow(const uint8_t* src, uint32_t* dst, const int width, const bool bgr,
+                const SDL_PixelFormatDetails& to)
+{
+    const int r = bgr ? 2 : 0;
+    const int b = bgr ? 0 : 2;
+    const uint32_t opaque = 0xFFu << to.Ashift;
+    for (int x = 0; x < width; ++x)
+    {
+        const uint8_t* p = src + x * 3;
+        dst[x] = opaque | static_cast<uint32_t>(p[r]) << to.Rshift |
+                 static_cast<uint32_t>(p[1]) << to.Gshift |
+                 static_cast<uint32_t>(p[b]) << to.Bshift;
+    }
+}
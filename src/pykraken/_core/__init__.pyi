@@ -1,6 +1,8 @@
 from __future__ import annotations
 import collections.abc
 import enum
+import numpy
+import numpy.typing
 import typing
 from . import color
 from . import draw
@@ -17,7 +19,155 @@ from . import renderer
 from . import time
 from . import transform
 from . import window
-__all__ = ['AUDIO_DEVICE_ADDED', 'AUDIO_DEVICE_REMOVED', 'Anchor', 'BOTTOM_LEFT', 'BOTTOM_MID', 'BOTTOM_RIGHT', 'CAMERA_ADDED', 'CAMERA_APPROVED', 'CAMERA_DENIED', 'CAMERA_REMOVED', 'CENTER', 'C_BACK', 'C_DPAD_DOWN', 'C_DPAD_LEFT', 'C_DPAD_RIGHT', 'C_DPAD_UP', 'C_EAST', 'C_GUIDE', 'C_LSHOULDER', 'C_LSTICK', 'C_LTRIGGER', 'C_LX', 'C_LY', 'C_NORTH', 'C_PS3', 'C_PS4', 'C_PS5', 'C_RSHOULDER', 'C_RSTICK', 'C_RTRIGGER', 'C_RX', 'C_RY', 'C_SOUTH', 'C_STANDARD', 'C_START', 'C_SWITCH_JOYCON_LEFT', 'C_SWITCH_JOYCON_PAIR', 'C_SWITCH_JOYCON_RIGHT', 'C_SWITCH_PRO', 'C_WEST', 'C_XBOX_360', 'C_XBOX_ONE', 'Camera', 'Circle', 'Color', 'DROP_BEGIN', 'DROP_COMPLETE', 'DROP_FILE', 'DROP_POSITION', 'DROP_TEXT', 'EasingAnimation', 'Event', 'EventType', 'GAMEPAD_ADDED', 'GAMEPAD_AXIS_MOTION', 'GAMEPAD_BUTTON_DOWN', 'GAMEPAD_BUTTON_UP', 'GAMEPAD_REMOVED', 'GAMEPAD_TOUCHPAD_DOWN', 'GAMEPAD_TOUCHPAD_MOTION', 'GAMEPAD_TOUCHPAD_UP', 'GamepadAxis', 'GamepadButton', 'GamepadType', 'InputAction', 'KEYBOARD_ADDED', 'KEYBOARD_REMOVED', 'KEY_DOWN', 'KEY_UP', 'K_0', 'K_1', 'K_2', 'K_3', 'K_4', 'K_5', 'K_6', 'K_7', 'K_8', 'K_9', 'K_AGAIN', 'K_AMPERSAND', 'K_ASTERISK', 'K_AT', 'K_BACKSLASH', 'K_BACKSPACE', 'K_CAPS', 'K_CARET', 'K_COLON', 'K_COMMA', 'K_COPY', 'K_CUT', 'K_DBLQUOTE', 'K_DEL', 'K_DOLLAR', 'K_DOWN', 'K_END', 'K_EQ', 'K_ESC', 'K_EXCLAIM', 'K_F1', 'K_F10', 'K_F11', 'K_F12', 'K_F2', 'K_F3', 'K_F4', 'K_F5', 'K_F6', 'K_F7', 'K_F8', 'K_F9', 'K_FIND', 'K_GRAVE', 'K_GT', 'K_HASH', 'K_HOME', 'K_INS', 'K_KP_0', 'K_KP_1', 'K_KP_2', 'K_KP_3', 'K_KP_4', 'K_KP_5', 'K_KP_6', 'K_KP_7', 'K_KP_8', 'K_KP_9', 'K_KP_DIV', 'K_KP_ENTER', 'K_KP_MINUS', 'K_KP_MULT', 'K_KP_PERIOD', 'K_KP_PLUS', 'K_LALT', 'K_LBRACE', 'K_LBRACKET', 'K_LCTRL', 'K_LEFT', 'K_LGUI', 'K_LPAREN', 'K_LSHIFT', 'K_LT', 'K_MINUS', 'K_MUTE', 'K_NUMLOCK', 'K_PASTE', 'K_PAUSE', 'K_PERCENT', 'K_PERIOD', 'K_PGDOWN', 'K_PGUP', 'K_PIPE', 'K_PLUS', 'K_PRTSCR', 'K_QUESTION', 'K_RALT', 'K_RBRACE', 'K_RBRACKET', 'K_RCTRL', 'K_RETURN', 'K_RGUI', 'K_RIGHT', 'K_RPAREN', 'K_RSHIFT', 'K_SCRLK', 'K_SEMICOLON', 'K_SGLQUOTE', 'K_SLASH', 'K_SPACE', 'K_TAB', 'K_TILDE', 'K_UNDERSCORE', 'K_UNDO', 'K_UP', 'K_VOLDOWN', 'K_VOLUP', 'K_a', 'K_b', 'K_c', 'K_d', 'K_e', 'K_f', 'K_g', 'K_h', 'K_i', 'K_j', 'K_k', 'K_l', 'K_m', 'K_n', 'K_o', 'K_p', 'K_q', 'K_r', 'K_s', 'K_t', 'K_u', 'K_v', 'K_w', 'K_x', 'K_y', 'K_z', 'Keycode', 'Line', 'MID_LEFT', 'MID_RIGHT', 'MOUSE_ADDED', 'MOUSE_BUTTON_DOWN', 'MOUSE_BUTTON_UP', 'MOUSE_MOTION', 'MOUSE_REMOVED', 'MOUSE_WHEEL', 'M_LEFT', 'M_MIDDLE', 'M_RIGHT', 'M_SIDE1', 'M_SIDE2', 'MouseButton', 'PEN_AXIS', 'PEN_BUTTON_DOWN', 'PEN_BUTTON_UP', 'PEN_DOWN', 'PEN_MOTION', 'PEN_PROXIMITY_IN', 'PEN_PROXIMITY_OUT', 'PEN_UP', 'PixelArray', 'PolarCoordinate', 'Polygon', 'QUIT', 'Rect', 'S_0', 'S_1', 'S_2', 'S_3', 'S_4', 'S_5', 'S_6', 'S_7', 'S_8', 'S_9', 'S_AGAIN', 'S_APOSTROPHE', 'S_BACKSLASH', 'S_BACKSPACE', 'S_CAPS', 'S_COMMA', 'S_COPY', 'S_CUT', 'S_DEL', 'S_DOWN', 'S_END', 'S_EQ', 'S_ESC', 'S_F1', 'S_F10', 'S_F11', 'S_F12', 'S_F2', 'S_F3', 'S_F4', 'S_F5', 'S_F6', 'S_F7', 'S_F8', 'S_F9', 'S_FIND', 'S_GRAVE', 'S_HOME', 'S_INS', 'S_KP_0', 'S_KP_1', 'S_KP_2', 'S_KP_3', 'S_KP_4', 'S_KP_5', 'S_KP_6', 'S_KP_7', 'S_KP_8', 'S_KP_9', 'S_KP_DIV', 'S_KP_ENTER', 'S_KP_MINUS', 'S_KP_MULT', 'S_KP_PERIOD', 'S_KP_PLUS', 'S_LALT', 'S_LBRACKET', 'S_LCTRL', 'S_LEFT', 'S_LGUI', 'S_LSHIFT', 'S_MINUS', 'S_MUTE', 'S_NUMLOCK', 'S_PASTE', 'S_PAUSE', 'S_PERIOD', 'S_PGDOWN', 'S_PGUP', 'S_PRTSCR', 'S_RALT', 'S_RBRACKET', 'S_RCTRL', 'S_RETURN', 'S_RGUI', 'S_RIGHT', 'S_RSHIFT', 'S_SCRLK', 'S_SEMICOLON', 'S_SLASH', 'S_SPACE', 'S_TAB', 'S_UNDO', 'S_UP', 'S_VOLDOWN', 'S_VOLUP', 'S_a', 'S_b', 'S_c', 'S_d', 'S_e', 'S_f', 'S_g', 'S_h', 'S_i', 'S_j', 'S_k', 'S_l', 'S_m', 'S_n', 'S_o', 'S_p', 'S_q', 'S_r', 'S_s', 'S_t', 'S_u', 'S_v', 'S_w', 'S_x', 'S_y', 'S_z', 'Scancode', 'TEXT_EDITING', 'TEXT_INPUT', 'TOP_LEFT', 'TOP_MID', 'TOP_RIGHT', 'Texture', 'Timer', 'Vec2', 'WINDOW_ENTER_FULLSCREEN', 'WINDOW_EXPOSED', 'WINDOW_FOCUS_GAINED', 'WINDOW_FOCUS_LOST', 'WINDOW_HIDDEN', 'WINDOW_LEAVE_FULLSCREEN', 'WINDOW_MAXIMIZED', 'WINDOW_MINIMIZED', 'WINDOW_MOUSE_ENTER', 'WINDOW_MOUSE_LEAVE', 'WINDOW_MOVED', 'WINDOW_OCCLUDED', 'WINDOW_RESIZED', 'WINDOW_RESTORED', 'WINDOW_SHOWN', 'color', 'draw', 'ease', 'event', 'gamepad', 'init', 'input', 'key', 'line', 'math', 'mouse', 'quit', 'rect', 'renderer', 'time', 'transform', 'window']
+__all__ = ['AABBTree', 'AUDIO_DEVICE_ADDED', 'AUDIO_DEVICE_REMOVED', 'Anchor', 'AssetHandle', 'AssetLoader', 'AtlasRegion', 'BOTTOM_LEFT', 'BOTTOM_MID', 'BOTTOM_RIGHT', 'BlurQuality', 'CAMERA_ADDED', 'CAMERA_APPROVED', 'CAMERA_DENIED', 'CAMERA_REMOVED', 'CENTER', 'C_BACK', 'C_DPAD_DOWN', 'C_DPAD_LEFT', 'C_DPAD_RIGHT', 'C_DPAD_UP', 'C_EAST', 'C_GUIDE', 'C_LSHOULDER', 'C_LSTICK', 'C_LTRIGGER', 'C_LX', 'C_LY', 'C_NORTH', 'C_PS3', 'C_PS4', 'C_PS5', 'C_RSHOULDER', 'C_RSTICK', 'C_RTRIGGER', 'C_RX', 'C_RY', 'C_SOUTH', 'C_STANDARD', 'C_START', 'C_SWITCH_JOYCON_LEFT', 'C_SWITCH_JOYCON_PAIR', 'C_SWITCH_JOYCON_RIGHT', 'C_SWITCH_PRO', 'C_WEST', 'C_XBOX_360', 'C_XBOX_ONE', 'Camera', 'Circle', 'Color', 'DROP_BEGIN', 'DROP_COMPLETE', 'DROP_FILE', 'DROP_POSITION', 'DROP_TEXT', 'EXACT', 'EasingAnimation', 'Event', 'EventType', 'FAST', 'GAMEPAD_ADDED', 'GAMEPAD_AXIS_MOTION', 'GAMEPAD_BUTTON_DOWN', 'GAMEPAD_BUTTON_UP', 'GAMEPAD_REMOVED', 'GAMEPAD_TOUCHPAD_DOWN', 'GAMEPAD_TOUCHPAD_MOTION', 'GAMEPAD_TOUCHPAD_UP', 'GamepadAxis', 'GamepadButton', 'GamepadType', 'InputAction', 'KEYBOARD_ADDED', 'KEYBOARD_REMOVED', 'KEY_DOWN', 'KEY_UP', 'K_0', 'K_1', 'K_2', 'K_3', 'K_4', 'K_5', 'K_6', 'K_7', 'K_8', 'K_9', 'K_AGAIN', 'K_AMPERSAND', 'K_ASTERISK', 'K_AT', 'K_BACKSLASH', 'K_BACKSPACE', 'K_CAPS', 'K_CARET', 'K_COLON', 'K_COMMA', 'K_COPY', 'K_CUT', 'K_DBLQUOTE', 'K_DEL', 'K_DOLLAR', 'K_DOWN', 'K_END', 'K_EQ', 'K_ESC', 'K_EXCLAIM', 'K_F1', 'K_F10', 'K_F11', 'K_F12', 'K_F2', 'K_F3', 'K_F4', 'K_F5', 'K_F6', 'K_F7', 'K_F8', 'K_F9', 'K_FIND', 'K_GRAVE', 'K_GT', 'K_HASH', 'K_HOME', 'K_INS', 'K_KP_0', 'K_KP_1', 'K_KP_2', 'K_KP_3', 'K_KP_4', 'K_KP_5', 'K_KP_6', 'K_KP_7', 'K_KP_8', 'K_KP_9', 'K_KP_DIV', 'K_KP_ENTER', 'K_KP_MINUS', 'K_KP_MULT', 'K_KP_PERIOD', 'K_KP_PLUS', 'K_LALT', 'K_LBRACE', 'K_LBRACKET', 'K_LCTRL', 'K_LEFT', 'K_LGUI', 'K_LPAREN', 'K_LSHIFT', 'K_LT', 'K_MINUS', 'K_MUTE', 'K_NUMLOCK', 'K_PASTE', 'K_PAUSE', 'K_PERCENT', 'K_PERIOD', 'K_PGDOWN', 'K_PGUP', 'K_PIPE', 'K_PLUS', 'K_PRTSCR', 'K_QUESTION', 'K_RALT', 'K_RBRACE', 'K_RBRACKET', 'K_RCTRL', 'K_RETURN', 'K_RGUI', 'K_RIGHT', 'K_RPAREN', 'K_RSHIFT', 'K_SCRLK', 'K_SEMICOLON', 'K_SGLQUOTE', 'K_SLASH', 'K_SPACE', 'K_TAB', 'K_TILDE', 'K_UNDERSCORE', 'K_UNDO', 'K_UP', 'K_VOLDOWN', 'K_VOLUP', 'K_a', 'K_b', 'K_c', 'K_d', 'K_e', 'K_f', 'K_g', 'K_h', 'K_i', 'K_j', 'K_k', 'K_l', 'K_m', 'K_n', 'K_o', 'K_p', 'K_q', 'K_r', 'K_s', 'K_t', 'K_u', 'K_v', 'K_w', 'K_x', 'K_y', 'K_z', 'Keycode', 'Line', 'MID_LEFT', 'MID_RIGHT', 'MOUSE_ADDED', 'MOUSE_BUTTON_DOWN', 'MOUSE_BUTTON_UP', 'MOUSE_MOTION', 'MOUSE_REMOVED', 'MOUSE_WHEEL', 'M_LEFT', 'M_MIDDLE', 'M_RIGHT', 'M_SIDE1', 'M_SIDE2', 'Mask', 'MouseButton', 'PEN_AXIS', 'PEN_BUTTON_DOWN', 'PEN_BUTTON_UP', 'PEN_DOWN', 'PEN_MOTION', 'PEN_PROXIMITY_IN', 'PEN_PROXIMITY_OUT', 'PEN_UP', 'PixelArray', 'PolarCoordinate', 'Polygon', 'QUIT', 'Rect', 'RenderTarget', 'S_0', 'S_1', 'S_2', 'S_3', 'S_4', 'S_5', 'S_6', 'S_7', 'S_8', 'S_9', 'S_AGAIN', 'S_APOSTROPHE', 'S_BACKSLASH', 'S_BACKSPACE', 'S_CAPS', 'S_COMMA', 'S_COPY', 'S_CUT', 'S_DEL', 'S_DOWN', 'S_END', 'S_EQ', 'S_ESC', 'S_F1', 'S_F10', 'S_F11', 'S_F12', 'S_F2', 'S_F3', 'S_F4', 'S_F5', 'S_F6', 'S_F7', 'S_F8', 'S_F9', 'S_FIND', 'S_GRAVE', 'S_HOME', 'S_INS', 'S_KP_0', 'S_KP_1', 'S_KP_2', 'S_KP_3', 'S_KP_4', 'S_KP_5', 'S_KP_6', 'S_KP_7', 'S_KP_8', 'S_KP_9', 'S_KP_DIV', 'S_KP_ENTER', 'S_KP_MINUS', 'S_KP_MULT', 'S_KP_PERIOD', 'S_KP_PLUS', 'S_LALT', 'S_LBRACKET', 'S_LCTRL', 'S_LEFT', 'S_LGUI', 'S_LSHIFT', 'S_MINUS', 'S_MUTE', 'S_NUMLOCK', 'S_PASTE', 'S_PAUSE', 'S_PERIOD', 'S_PGDOWN', 'S_PGUP', 'S_PRTSCR', 'S_RALT', 'S_RBRACKET', 'S_RCTRL', 'S_RETURN', 'S_RGUI', 'S_RIGHT', 'S_RSHIFT', 'S_SCRLK', 'S_SEMICOLON', 'S_SLASH', 'S_SPACE', 'S_TAB', 'S_UNDO', 'S_UP', 'S_VOLDOWN', 'S_VOLUP', 'S_a', 'S_b', 'S_c', 'S_d', 'S_e', 'S_f', 'S_g', 'S_h', 'S_i', 'S_j', 'S_k', 'S_l', 'S_m', 'S_n', 'S_o', 'S_p', 'S_q', 'S_r', 'S_s', 'S_t', 'S_u', 'S_v', 'S_w', 'S_x', 'S_y', 'S_z', 'Scancode', 'SpatialHash', 'TEXT_EDITING', 'TEXT_INPUT', 'TOP_LEFT', 'TOP_MID', 'TOP_RIGHT', 'Texture', 'TextureAtlas', 'TileMap', 'Timer', 'Vec2', 'WINDOW_ENTER_FULLSCREEN', 'WINDOW_EXPOSED', 'WINDOW_FOCUS_GAINED', 'WINDOW_FOCUS_LOST', 'WINDOW_HIDDEN', 'WINDOW_LEAVE_FULLSCREEN', 'WINDOW_MAXIMIZED', 'WINDOW_MINIMIZED', 'WINDOW_MOUSE_ENTER', 'WINDOW_MOUSE_LEAVE', 'WINDOW_MOVED', 'WINDOW_OCCLUDED', 'WINDOW_RESIZED', 'WINDOW_RESTORED', 'WINDOW_SHOWN', 'color', 'draw', 'ease', 'event', 'gamepad', 'init', 'input', 'key', 'line', 'math', 'mouse', 'quit', 'rect', 'renderer', 'time', 'transform', 'window']
+class AABBTree:
+    """
+    
+    A bounding volume hierarchy for finding shapes near a region or along a line.
+    
+    Each shape is stored by integer id as its axis-aligned bounding box. Unlike SpatialHash,
+    the tree adapts to shapes of very different sizes and to sparse worlds, which makes it a
+    good fit for level geometry and line-of-sight checks.
+    
+    Stored boxes are enlarged by a margin, so shapes that move a little do not change the
+    tree. After building a static world with many inserts, call rebuild() once for faster
+    queries.
+        
+    """
+    def __contains__(self, id: typing.SupportsInt) -> bool:
+        ...
+    def __init__(self, margin: typing.SupportsFloat = 4.0) -> None:
+        """
+        Create an empty tree.
+        
+        Args:
+            margin (float, optional): How far stored boxes are enlarged on each side. Larger
+                                      margins make moves cheaper and queries slower. Defaults to 4.
+        
+        Raises:
+            ValueError: If margin is negative.
+        """
+    def __len__(self) -> int:
+        ...
+    def clear(self) -> None:
+        """
+        Remove every shape.
+        """
+    @typing.overload
+    def insert(self, id: typing.SupportsInt, rect: Rect) -> None:
+        """
+        Add a rectangle.
+        
+        Args:
+            id (int): The id to store the rectangle under.
+            rect (Rect): The rectangle's bounds.
+        
+        Raises:
+            ValueError: If the id is already in the tree.
+        """
+    @typing.overload
+    def insert(self, id: typing.SupportsInt, circle: Circle) -> None:
+        """
+        Add a circle, stored as its bounding box.
+        
+        Args:
+            id (int): The id to store the circle under.
+            circle (Circle): The circle.
+        
+        Raises:
+            ValueError: If the id is already in the tree.
+        """
+    @typing.overload
+    def move(self, id: typing.SupportsInt, rect: Rect) -> None:
+        """
+        Update the bounds stored under an id.
+        
+        Args:
+            id (int): The id of the shape to move.
+            rect (Rect): The new bounds.
+        
+        Raises:
+            KeyError: If the id is not in the tree.
+        """
+    @typing.overload
+    def move(self, id: typing.SupportsInt, circle: Circle) -> None:
+        """
+        Update the bounds stored under an id to those of a circle.
+        
+        Args:
+            id (int): The id of the shape to move.
+            circle (Circle): The new circle.
+        
+        Raises:
+            KeyError: If the id is not in the tree.
+        """
+    def query_circle(self, circle: Circle) -> numpy.typing.NDArray[numpy.int64]:
+        """
+        Find the shapes whose bounds touch a circle.
+        
+        Args:
+            circle (Circle): The region to search.
+        
+        Returns:
+            numpy.ndarray: Array with shape (N,) of the matching ids.
+        """
+    def query_point(self, point: Vec2) -> numpy.typing.NDArray[numpy.int64]:
+        """
+        Find the shapes whose bounds contain a point, including their edges.
+        
+        Args:
+            point (Vec2): The point to test.
+        
+        Returns:
+            numpy.ndarray: Array with shape (N,) of the matching ids.
+        """
+    def query_rect(self, rect: Rect) -> numpy.typing.NDArray[numpy.int64]:
+        """
+        Find the shapes whose bounds overlap a rectangle.
+        
+        Args:
+            rect (Rect): The region to search.
+        
+        Returns:
+            numpy.ndarray: Array with shape (N,) of the matching ids.
+        """
+    def raycast(self, line: Line) -> numpy.typing.NDArray[numpy.int64]:
+        """
+        Find the shapes whose bounds the line segment from a to b touches.
+        
+        Args:
+            line (Line): The segment to cast.
+        
+        Returns:
+            numpy.ndarray: Array with shape (N,) of the hit ids, nearest to point a first.
+        """
+    def rebuild(self) -> None:
+        """
+        Rebuild the whole tree from its current shapes for the fastest queries.
+        
+        Inserting shapes one at a time keeps the tree balanced but not optimal. This is worth
+        calling once after loading a level, not every frame.
+        """
+    def remove(self, id: typing.SupportsInt) -> None:
+        """
+        Remove the shape stored under an id.
+        
+        Args:
+            id (int): The id of the shape to remove.
+        
+        Raises:
+            KeyError: If the id is not in the tree.
+        """
+    @property
+    def height(self) -> int:
+        """
+        The number of levels in the tree, or 0 if it is empty.
+        """
+    @property
+    def margin(self) -> float:
+        """
+        How far stored boxes are enlarged on each side.
+        """
 class Anchor(enum.IntEnum):
     BOTTOM_LEFT: typing.ClassVar[Anchor]  # value = <Anchor.BOTTOM_LEFT: 6>
     BOTTOM_MID: typing.ClassVar[Anchor]  # value = <Anchor.BOTTOM_MID: 7>
@@ -35,6 +185,196 @@ class Anchor(enum.IntEnum):
         """
         Convert to a string according to format_spec.
         """
+class AssetHandle:
+    """
+    
+    The pending result of an AssetLoader request.
+    
+    The image is decoded on a loader thread. Texture requests are then uploaded to the GPU
+    by AssetLoader.update(), or immediately by get() if they are needed sooner.
+        
+    """
+    def get(self) -> typing.Any:
+        """
+        Get the loaded asset, waiting for it if necessary.
+        
+        Waiting releases the GIL so other Python threads keep running. A texture that is
+        decoded but not yet uploaded is uploaded right away, so call this from the main thread.
+        
+        Returns:
+            Texture | PixelArray: The loaded asset.
+        
+        Raises:
+            RuntimeError: If the asset failed to load.
+        """
+    @property
+    def done(self) -> bool:
+        """
+        Whether the asset has finished loading, successfully or not.
+        """
+    @property
+    def error(self) -> str:
+        """
+        The reason the asset failed to load, or an empty string.
+        """
+    @property
+    def failed(self) -> bool:
+        """
+        Whether the asset failed to load.
+        """
+    @property
+    def path(self) -> str:
+        """
+        The path of the requested image file.
+        """
+class AssetLoader:
+    """
+    
+    Loads images in the background so that loading does not stall the game.
+    
+    Image files are read and decoded by a pool of loader threads. Pixel arrays are ready as
+    soon as they are decoded. Textures must be uploaded on the main thread, which update()
+    does within a time budget each frame.
+        
+    """
+    def __init__(self, threads: typing.SupportsInt = 0) -> None:
+        """
+        Create an asset loader and start its threads.
+        
+        Args:
+            threads (int, optional): The number of loader threads. Defaults to 0, which picks one
+                                     based on the number of CPU cores.
+        
+        Raises:
+            ValueError: If threads is negative.
+        """
+    def load_pixel_array(self, file_path: str, premultiplied: bool = False) -> AssetHandle:
+        """
+        Request a pixel array to be loaded in the background.
+        
+        Args:
+            file_path (str): Path to the image file to load.
+            premultiplied (bool, optional): Whether to premultiply the color channels by alpha.
+                                            Defaults to False.
+        
+        Returns:
+            AssetHandle: A handle that yields the PixelArray once it is loaded.
+        
+        Raises:
+            ValueError: If file_path is empty.
+        """
+    def load_texture(self, file_path: str, premultiplied: bool = False) -> AssetHandle:
+        """
+        Request a texture to be loaded in the background.
+        
+        Args:
+            file_path (str): Path to the image file to load.
+            premultiplied (bool, optional): Whether to premultiply the color channels by alpha and
+                                            blend accordingly. Defaults to False.
+        
+        Returns:
+            AssetHandle: A handle that yields the Texture once it is loaded.
+        
+        Raises:
+            ValueError: If file_path is empty.
+        """
+    def update(self, budget_ms: typing.SupportsFloat = 2.0) -> int:
+        """
+        Upload decoded textures to the GPU, stopping once the time budget is spent.
+        
+        Call this once per frame from the main thread. At least one waiting texture is uploaded
+        per call, so loading always makes progress.
+        
+        Args:
+            budget_ms (float, optional): The time to spend uploading, in milliseconds.
+                                         Defaults to 2.0.
+        
+        Returns:
+            int: The number of textures uploaded.
+        """
+    @property
+    def pending(self) -> int:
+        """
+        The number of requests that are still being decoded or waiting to be uploaded.
+        """
+class AtlasRegion:
+    """
+    
+    A lightweight handle to a sub-image packed into a TextureAtlas page.
+    
+    Regions render like a Texture but share their page texture with every other region on
+    the same page, so consecutive region draws can be batched together. Tint, alpha and
+    blend mode are properties of the shared page texture.
+        
+    """
+    def get_rect(self) -> Rect:
+        """
+        Get a rectangle representing the region bounds.
+        
+        Returns:
+            Rect: A rectangle with position (0, 0) and the region's dimensions.
+        """
+    def get_size(self) -> Vec2:
+        """
+        Get the size of the region.
+        
+        Returns:
+            Vec2: The region size as (width, height).
+        """
+    @typing.overload
+    def render(self, dst: Rect, src: typing.Any = None) -> None:
+        """
+        Render this region with specified destination and source rectangles.
+        
+        Args:
+            dst (Rect): The destination rectangle on the renderer.
+            src (Rect, optional): The source rectangle, relative to the region. Defaults to the entire region.
+        """
+    @typing.overload
+    def render(self, pos: typing.Any = None, anchor: Anchor = Anchor.CENTER) -> None:
+        """
+        Render this region at the specified position with anchor alignment.
+        
+        Args:
+            pos (Vec2, optional): The position to draw at. Defaults to (0, 0).
+            anchor (Anchor, optional): The anchor point for positioning. Defaults to CENTER.
+        """
+    @property
+    def angle(self) -> float:
+        """
+        The rotation angle in degrees for rendering.
+        """
+    @angle.setter
+    def angle(self, arg0: typing.SupportsFloat) -> None:
+        ...
+    @property
+    def flip(self) -> Texture.Flip:
+        """
+        The flip settings for horizontal and vertical mirroring.
+        """
+    @flip.setter
+    def flip(self, arg0: Texture.Flip) -> None:
+        ...
+    @property
+    def src_rect(self) -> Rect:
+        """
+        The region's rectangle within its atlas page.
+        """
+    @property
+    def texture(self) -> Texture:
+        """
+        The atlas page texture this region lives on.
+        """
+class BlurQuality(enum.IntEnum):
+    EXACT: typing.ClassVar[BlurQuality]  # value = <BlurQuality.EXACT: 0>
+    FAST: typing.ClassVar[BlurQuality]  # value = <BlurQuality.FAST: 1>
+    @classmethod
+    def __new__(cls, value):
+        ...
+    def __format__(self, format_spec):
+        """
+        Convert to a string according to format_spec.
+        """
 class Camera:
     """
     
@@ -911,7 +1251,235 @@ class Line:
     @property
     def length(self) -> float:
         """
-        The Euclidean length of the line segment.
+        The Euclidean length of the line segment.
+        """
+class Mask:
+    """
+    
+    A collision mask for pixel-perfect collision detection.
+    
+    A Mask represents a 2D bitmap, typically used for precise collision detection based on
+    non-transparent pixels. Each row is stored as packed 64-bit words, so collision tests
+    compare 64 pixels at a time.
+    
+    Offsets passed to the collision methods are the position of the other mask relative
+    to this one.
+        
+    """
+    def __bool__(self) -> bool:
+        """
+        Check if the mask is valid (always True for existing masks).
+        """
+    @typing.overload
+    def __init__(self, size: Vec2, filled: bool = False) -> None:
+        """
+        Create a mask of the given size.
+        
+        Args:
+            size (Vec2): The mask size as (width, height).
+            filled (bool, optional): Whether every pixel starts solid. Defaults to False.
+        
+        Raises:
+            ValueError: If the size is negative.
+        """
+    @typing.overload
+    def __init__(self, pixel_array: PixelArray, threshold: typing.SupportsInt = 1) -> None:
+        """
+        Create a mask from a pixel array based on alpha threshold.
+        
+        Args:
+            pixel_array (PixelArray): The source pixel array to create the mask from.
+            threshold (int, optional): Alpha threshold value (0-255). Pixels with alpha >= threshold
+                                       are solid. Defaults to 1, so only fully transparent pixels
+                                       are empty.
+        
+        Raises:
+            RuntimeError: If the pixel array is invalid.
+        """
+    def add(self, other: Mask, offset: Vec2) -> None:
+        """
+        Make every pixel that is solid in another mask solid in this one.
+        
+        Args:
+            other (Mask): The mask to add.
+            offset (Vec2): The position of the other mask relative to this one.
+        """
+    def clear(self) -> None:
+        """
+        Set every pixel of the mask to empty.
+        """
+    def collide_mask(self, other: Mask, offset: Vec2) -> bool:
+        """
+        Check collision between this mask and another mask with an offset.
+        
+        Args:
+            other (Mask): The other mask to test collision with.
+            offset (Vec2): The position of the other mask relative to this one.
+        
+        Returns:
+            bool: True if the masks collide, False otherwise.
+        """
+    def copy(self) -> Mask:
+        """
+        Create a copy of this mask.
+        
+        Returns:
+            Mask: A new mask with the same size and pixels.
+        """
+    def fill(self) -> None:
+        """
+        Set every pixel of the mask to solid.
+        """
+    def get_at(self, pos: Vec2) -> bool:
+        """
+        Get the pixel value at a specific position.
+        
+        Args:
+            pos (Vec2): The position to check.
+        
+        Returns:
+            bool: True if the pixel is solid (above threshold), False otherwise.
+        """
+    def get_bounding_rect(self) -> Rect:
+        """
+        Get the smallest rectangle containing every solid pixel.
+        
+        Returns:
+            Rect: The bounding rectangle, or a zero-size rectangle at (0, 0) if the mask is empty.
+        """
+    def get_center_of_mass(self) -> Vec2:
+        """
+        Get the average position of the solid pixels.
+        
+        Returns:
+            Vec2: The center of mass, or (0, 0) if the mask is empty.
+        """
+    @typing.overload
+    def get_collision_points(self, other: Mask, offset: Vec2) -> list[Vec2]:
+        """
+        Get the positions of the solid pixels the two masks share.
+        
+        Args:
+            other (Mask): The other mask to test against.
+            offset (Vec2): The position of the other mask relative to this one.
+        
+        Returns:
+            list[Vec2]: The overlapping pixels in this mask's coordinates, in row order.
+        """
+    @typing.overload
+    def get_collision_points(self, other: Mask, rect_a: Rect, rect_b: Rect) -> list[Vec2]:
+        """
+        Get the positions of the solid pixels the two masks share when placed at two rectangles.
+        
+        Args:
+            other (Mask): The other mask to test against.
+            rect_a (Rect): The rectangle this mask is drawn at. Only its position is used.
+            rect_b (Rect): The rectangle the other mask is drawn at. Only its position is used.
+        
+        Returns:
+            list[Vec2]: The overlapping pixels in the rectangles' coordinate space, in row order.
+        """
+    def get_count(self) -> int:
+        """
+        Count the solid pixels in the mask.
+        
+        Returns:
+            int: The number of solid pixels.
+        """
+    def get_outline(self) -> list[Vec2]:
+        """
+        Trace the outline of the first solid shape in the mask.
+        
+        The shape is the one containing the topmost, then leftmost, solid pixel. Its border is
+        followed clockwise using 8-connectivity.
+        
+        Returns:
+            list[Vec2]: The border pixels in tracing order, or an empty list if the mask is empty.
+        """
+    def get_overlap_area(self, other: Mask, offset: Vec2) -> int:
+        """
+        Count the solid pixels the two masks share.
+        
+        Args:
+            other (Mask): The other mask to test against.
+            offset (Vec2): The position of the other mask relative to this one.
+        
+        Returns:
+            int: The number of overlapping solid pixels.
+        """
+    def get_overlap_mask(self, other: Mask, offset: Vec2) -> Mask:
+        """
+        Get a mask of the solid pixels the two masks share.
+        
+        Args:
+            other (Mask): The other mask to test against.
+            offset (Vec2): The position of the other mask relative to this one.
+        
+        Returns:
+            Mask: A mask the size of this one, set where both masks are solid.
+        """
+    def get_rect(self) -> Rect:
+        """
+        Get a rectangle representing the mask bounds.
+        
+        Returns:
+            Rect: A rectangle with position (0, 0) and the mask's dimensions.
+        """
+    def get_size(self) -> Vec2:
+        """
+        Get the size of the mask.
+        
+        Returns:
+            Vec2: The mask size as (width, height).
+        """
+    def invert(self) -> None:
+        """
+        Flip every pixel of the mask between solid and empty.
+        """
+    def is_empty(self) -> bool:
+        """
+        Check whether the mask has no solid pixels.
+        
+        Returns:
+            bool: True if no pixel is solid, False otherwise.
+        """
+    def set_at(self, pos: Vec2, value: bool) -> None:
+        """
+        Set the pixel value at a specific position. Positions outside the mask are ignored.
+        
+        Args:
+            pos (Vec2): The position to set.
+            value (bool): Whether the pixel is solid.
+        """
+    def subtract(self, other: Mask, offset: Vec2) -> None:
+        """
+        Make every pixel that is solid in another mask empty in this one.
+        
+        Args:
+            other (Mask): The mask to subtract.
+            offset (Vec2): The position of the other mask relative to this one.
+        """
+    @property
+    def height(self) -> int:
+        """
+        The height of the mask in pixels.
+        """
+    @property
+    def size(self) -> tuple:
+        """
+        Create a mask of the given size.
+        
+        Args:
+            size (Vec2): The mask size as (width, height).
+            filled (bool, optional): Whether every pixel starts solid. Defaults to False.
+        
+        Raises:
+            ValueError: If the size is negative.
+        """
+    @property
+    def width(self) -> int:
+        """
+        The width of the mask in pixels.
         """
 class MouseButton(enum.IntEnum):
     M_LEFT: typing.ClassVar[MouseButton]  # value = <MouseButton.M_LEFT: 1>
@@ -934,6 +1502,11 @@ class PixelArray:
     A PixelArray is a 2D array of pixels that can be manipulated, drawn on, and used as a source
     for texture creation or blitting to other PixelArrays. Supports pixel-level operations,
     color key transparency, and alpha blending.
+    
+    PixelArray supports the buffer protocol: ``numpy.asarray(pixel_array)`` returns a writable
+    (height, width, 4) uint8 RGBA view of the pixels without copying. Exporting a view converts
+    the pixel array to the RGBA32 format if it uses another format. While any view is alive,
+    writing a transform result of a different size into the pixel array raises BufferError.
         
     """
     @typing.overload
@@ -948,12 +1521,17 @@ class PixelArray:
             RuntimeError: If pixel array creation fails.
         """
     @typing.overload
-    def __init__(self, file_path: str) -> None:
+    def __init__(self, file_path: str, premultiplied: bool = False) -> None:
         """
         Create a PixelArray by loading an image from a file.
         
+        The pixels are converted to the RGBA32 format on load.
+        
         Args:
             file_path (str): Path to the image file to load.
+            premultiplied (bool, optional): Whether to multiply the color channels by alpha on load.
+                                            Textures created from a premultiplied pixel array blend
+                                            accordingly. Defaults to False.
         
         Raises:
             RuntimeError: If the file cannot be loaded or doesn't exist.
@@ -1002,6 +1580,27 @@ class PixelArray:
         Args:
             color (Color): The color to fill the pixel array with.
         """
+    @staticmethod
+    def from_numpy(array: numpy.ndarray, copy: bool = False) -> PixelArray:
+        """
+        Create a PixelArray from a NumPy array of RGBA pixels.
+        
+        Without copying, the pixel array shares memory with the given array and keeps it alive,
+        so changes to either are visible in both.
+        
+        Args:
+            array (numpy.ndarray): Array with shape (height, width, 4) and dtype uint8.
+            copy (bool, optional): Whether to copy the pixels instead of sharing the array's memory.
+                                   Defaults to False.
+        
+        Returns:
+            PixelArray: The new pixel array.
+        
+        Raises:
+            ValueError: If the array shape or dtype is invalid, or if copy is False and the array
+                        is not writable or its rows are not contiguous RGBA pixels.
+            RuntimeError: If pixel array creation fails.
+        """
     def get_at(self, coord: Vec2) -> Color:
         """
         Get the color of a pixel at the specified coordinates.
@@ -1069,6 +1668,11 @@ class PixelArray:
             int: The pixel array height.
         """
     @property
+    def premultiplied(self) -> bool:
+        """
+        Whether the color channels are premultiplied by alpha.
+        """
+    @property
     def rect(self) -> Rect:
         """
         A rectangle representing the pixel array bounds.
@@ -1697,6 +2301,41 @@ class Rect:
     @y.setter
     def y(self, arg0: typing.SupportsFloat) -> None:
         ...
+class RenderTarget(Texture):
+    """
+    
+    A texture that can be drawn into, then rendered like any other Texture.
+    
+    Use it to render static layers such as backgrounds, UI panels or lighting maps once
+    and reuse them across frames. Drawing is redirected into the target either with
+    renderer.set_target() or by using the target as a context manager:
+    
+        with target:
+            kn.renderer.clear()
+            ...  # draw calls go into the target
+    
+    The previous target is restored when the block exits.
+        
+    """
+    def __enter__(self) -> RenderTarget:
+        """
+        Redirect drawing into this target until the block exits.
+        """
+    def __exit__(self, *args) -> None:
+        """
+        Restore the render target that was active before entering the block.
+        """
+    def __init__(self, size: Vec2) -> None:
+        """
+        Create a transparent render target.
+        
+        Args:
+            size (Vec2): The size of the target as (width, height).
+        
+        Raises:
+            ValueError: If either dimension is not positive.
+            RuntimeError: If target texture creation fails.
+        """
 class Scancode(enum.IntEnum):
     S_0: typing.ClassVar[Scancode]  # value = <Scancode.S_0: 39>
     S_1: typing.ClassVar[Scancode]  # value = <Scancode.S_1: 30>
@@ -1817,6 +2456,138 @@ class Scancode(enum.IntEnum):
         """
         Convert to a string according to format_spec.
         """
+class SpatialHash:
+    """
+    
+    A uniform grid for finding overlapping rectangles and circles without testing every pair.
+    
+    Each shape is stored by integer id as its axis-aligned bounding box. The grid is rebuilt
+    lazily on the next query, and only when a shape has moved into different cells. Cells
+    should be about the size of a typical shape: much smaller cells make large shapes span
+    many cells, and much larger cells put many shapes in each cell.
+        
+    """
+    def __contains__(self, id: typing.SupportsInt) -> bool:
+        ...
+    def __init__(self, cell_size: typing.SupportsFloat = 64.0) -> None:
+        """
+        Create an empty spatial hash.
+        
+        Args:
+            cell_size (float, optional): The width and height of a grid cell. Defaults to 64.
+        
+        Raises:
+            ValueError: If cell_size is not positive.
+        """
+    def __len__(self) -> int:
+        ...
+    def clear(self) -> None:
+        """
+        Remove every shape.
+        """
+    @typing.overload
+    def insert(self, id: typing.SupportsInt, rect: Rect) -> None:
+        """
+        Add a rectangle.
+        
+        Args:
+            id (int): The id to store the rectangle under.
+            rect (Rect): The rectangle's bounds.
+        
+        Raises:
+            ValueError: If the id is already in the hash.
+        """
+    @typing.overload
+    def insert(self, id: typing.SupportsInt, circle: Circle) -> None:
+        """
+        Add a circle, stored as its bounding box.
+        
+        Args:
+            id (int): The id to store the circle under.
+            circle (Circle): The circle.
+        
+        Raises:
+            ValueError: If the id is already in the hash.
+        """
+    @typing.overload
+    def move(self, id: typing.SupportsInt, rect: Rect) -> None:
+        """
+        Update the bounds stored under an id.
+        
+        Args:
+            id (int): The id of the shape to move.
+            rect (Rect): The new bounds.
+        
+        Raises:
+            KeyError: If the id is not in the hash.
+        """
+    @typing.overload
+    def move(self, id: typing.SupportsInt, circle: Circle) -> None:
+        """
+        Update the bounds stored under an id to those of a circle.
+        
+        Args:
+            id (int): The id of the shape to move.
+            circle (Circle): The new circle.
+        
+        Raises:
+            KeyError: If the id is not in the hash.
+        """
+    def query_circle(self, circle: Circle) -> numpy.typing.NDArray[numpy.int64]:
+        """
+        Find the shapes whose bounds touch a circle.
+        
+        Args:
+            circle (Circle): The region to search.
+        
+        Returns:
+            numpy.ndarray: Array with shape (N,) of the matching ids.
+        """
+    def query_pairs(self) -> numpy.typing.NDArray[numpy.int64]:
+        """
+        Find every pair of shapes whose bounds overlap.
+        
+        Each pair is reported once, with the smaller id first. Bounds that only touch at an
+        edge do not overlap, matching Rect.collide_rect.
+        
+        Returns:
+            numpy.ndarray: Array with shape (K,2) of overlapping id pairs.
+        """
+    def query_point(self, point: Vec2) -> numpy.typing.NDArray[numpy.int64]:
+        """
+        Find the shapes whose bounds contain a point, including their edges.
+        
+        Args:
+            point (Vec2): The point to test.
+        
+        Returns:
+            numpy.ndarray: Array with shape (N,) of the matching ids.
+        """
+    def query_rect(self, rect: Rect) -> numpy.typing.NDArray[numpy.int64]:
+        """
+        Find the shapes whose bounds overlap a rectangle.
+        
+        Args:
+            rect (Rect): The region to search.
+        
+        Returns:
+            numpy.ndarray: Array with shape (N,) of the matching ids.
+        """
+    def remove(self, id: typing.SupportsInt) -> None:
+        """
+        Remove the shape stored under an id.
+        
+        Args:
+            id (int): The id of the shape to remove.
+        
+        Raises:
+            KeyError: If the id is not in the hash.
+        """
+    @property
+    def cell_size(self) -> float:
+        """
+        The width and height of a grid cell.
+        """
 class Texture:
     """
     
@@ -1857,12 +2628,14 @@ class Texture:
         def v(self, arg0: bool) -> None:
             ...
     @typing.overload
-    def __init__(self, file_path: str) -> None:
+    def __init__(self, file_path: str, premultiplied: bool = False) -> None:
         """
         Create a Texture by loading an image from a file.
         
         Args:
             file_path (str): Path to the image file to load.
+            premultiplied (bool, optional): Whether to premultiply the color channels by alpha on
+                                            load and blend accordingly. Defaults to False.
         
         Raises:
             ValueError: If file_path is empty.
@@ -1873,12 +2646,30 @@ class Texture:
         """
         Create a Texture from an existing PixelArray.
         
+        A premultiplied pixel array creates a texture that blends premultiplied colors.
+        
         Args:
             pixel_array (PixelArray): The pixel array to convert to a texture.
         
         Raises:
             RuntimeError: If texture creation from pixel array fails.
         """
+    @typing.overload
+    def __init__(self, mips: collections.abc.Sequence[PixelArray]) -> None:
+        """
+        Create a Texture from a mip chain, such as the one returned by transform.build_mips.
+        
+        The first level is the full-size texture. When the texture is drawn at less than half its
+        size, the level closest to (and no smaller than) the drawn size is sampled instead, so
+        shrunken sprites do not shimmer. All levels are filtered linearly.
+        
+        Args:
+            mips (list[PixelArray]): The levels from largest to smallest.
+        
+        Raises:
+            ValueError: If mips is empty or a level is larger than the one before it.
+            RuntimeError: If texture creation fails.
+        """
     def get_alpha(self) -> float:
         """
         Get the current alpha modulation value.
@@ -1945,6 +2736,27 @@ class Texture:
             pos (Vec2, optional): The position to draw at. Defaults to (0, 0).
             anchor (Anchor, optional): The anchor point for positioning. Defaults to CENTER.
         """
+    def render_many(self, positions: typing.Annotated[numpy.typing.ArrayLike, numpy.float64], src_rects: typing.Any = None, angles: typing.Any = None, scales: typing.Any = None, tints: typing.Any = None) -> None:
+        """
+        Render many instances of this texture from NumPy arrays in a single submission.
+        
+        Each instance is centered on its position. Camera offset and off-screen culling are
+        applied in C++, and all visible instances are emitted as one geometry batch.
+        
+        Args:
+            positions (numpy.ndarray): Array with shape (N,2) containing the center x,y of each instance.
+            src_rects (numpy.ndarray, optional): Array with shape (N,4) containing x,y,w,h source
+                                                 rectangles. Defaults to the entire texture.
+            angles (numpy.ndarray, optional): Array with shape (N,) of rotation angles in degrees.
+                                              Defaults to the texture's angle.
+            scales (numpy.ndarray, optional): Array with shape (N,) of uniform scale factors. Defaults to 1.
+            tints (numpy.ndarray, optional): Array with shape (N,4) of uint8 RGBA tints, multiplied with
+                                             the texture's tint and alpha.
+        
+        Raises:
+            ValueError: If any array has the wrong shape or length.
+            RuntimeError: If rendering fails.
+        """
     def set_alpha(self, alpha: typing.SupportsFloat) -> None:
         """
         Set the alpha (transparency) modulation for the texture.
@@ -1983,6 +2795,241 @@ class Texture:
     @flip.setter
     def flip(self, arg0: Texture.Flip) -> None:
         ...
+    @property
+    def mip_levels(self) -> int:
+        """
+        The number of resolution levels, including the full-size texture.
+        
+        Textures created from a single image or pixel array have one level.
+        """
+    @property
+    def premultiplied(self) -> bool:
+        """
+        Whether the texture's color channels are premultiplied by alpha.
+        
+        Normal and additive blending account for this automatically.
+        """
+class TextureAtlas:
+    """
+    
+    Packs many images into a few large textures to minimize texture switches.
+    
+    Images are queued with add() and packed with build(), which uses a skyline packer to
+    place them onto one or more square pages. Each packed image is then available as an
+    AtlasRegion by name.
+    
+    All pages share one alpha layout, chosen when the atlas is created. Straight alpha images
+    added to a premultiplied atlas are premultiplied as they are queued.
+        
+    """
+    def __contains__(self, name: str) -> bool:
+        ...
+    def __getitem__(self, name: str) -> AtlasRegion:
+        ...
+    def __init__(self, page_size: typing.SupportsInt = 2048, padding: typing.SupportsInt = 1, *, premultiplied: bool = False) -> None:
+        """
+        Create an empty texture atlas.
+        
+        Args:
+            page_size (int, optional): The width and height of each atlas page. Defaults to 2048.
+            padding (int, optional): Transparent pixels kept between packed images. Defaults to 1.
+            premultiplied (bool, optional): Whether the pages store premultiplied colors and blend
+                                            accordingly. Defaults to False.
+        
+        Raises:
+            ValueError: If page_size is not positive or padding is negative.
+        """
+    def __len__(self) -> int:
+        ...
+    @typing.overload
+    def add(self, name: str, pixel_array: PixelArray) -> None:
+        """
+        Queue a pixel array to be packed into the atlas.
+        
+        Args:
+            name (str): The name used to look up the region after building.
+            pixel_array (PixelArray): The image to pack. Its pixels are copied.
+        
+        Raises:
+            ValueError: If the name is already used, the image is larger than a page, or the image
+                        is premultiplied and the atlas is not.
+        """
+    @typing.overload
+    def add(self, name: str, file_path: str) -> None:
+        """
+        Queue an image file to be packed into the atlas.
+        
+        Args:
+            name (str): The name used to look up the region after building.
+            file_path (str): Path to the image file to load.
+        
+        Raises:
+            ValueError: If the name is already used or the image is larger than a page.
+            RuntimeError: If the file cannot be loaded.
+        """
+    def build(self) -> None:
+        """
+        Pack all queued images onto new atlas pages and create their regions.
+        
+        Images queued after a build are packed onto fresh pages by the next build.
+        
+        Raises:
+            RuntimeError: If page texture creation fails.
+        """
+    def get(self, name: str) -> AtlasRegion:
+        """
+        Get a packed region by name.
+        
+        Args:
+            name (str): The name the image was added with.
+        
+        Returns:
+            AtlasRegion: The packed region.
+        
+        Raises:
+            KeyError: If no built region has that name.
+        """
+    @property
+    def pages(self) -> list[Texture]:
+        """
+        The list of atlas page textures.
+        """
+    @property
+    def premultiplied(self) -> bool:
+        """
+        Whether the atlas pages store premultiplied colors.
+        """
+class TileMap:
+    """
+    
+    A grid of tiles drawn from a tileset texture with cached chunk geometry.
+    
+    The map is split into square chunks whose vertex data is built once and only rebuilt
+    when one of their tiles changes. Rendering draws just the chunks that intersect the
+    active camera's view, in a single geometry submission.
+    
+    Tile ids index the tileset left-to-right, top-to-bottom. Negative ids are empty.
+        
+    """
+    def __init__(self, tileset: Texture, tile_size: Vec2, tiles: typing.Annotated[numpy.typing.ArrayLike, numpy.int32], chunk_size: typing.SupportsInt = 16) -> None:
+        """
+        Create a tile map.
+        
+        Args:
+            tileset (Texture): The texture containing the tile images laid out in a grid.
+            tile_size (Vec2): The size of a single tile in pixels as (width, height).
+            tiles (numpy.ndarray): Array with shape (rows, cols) of integer tile ids.
+            chunk_size (int, optional): The width and height of a chunk in tiles. Defaults to 16.
+        
+        Raises:
+            ValueError: If the tile size, chunk size or tiles array shape is invalid.
+        """
+    def get_tile(self, col: typing.SupportsInt, row: typing.SupportsInt) -> int:
+        """
+        Get the tile id at a grid cell.
+        
+        Args:
+            col (int): The tile column.
+            row (int): The tile row.
+        
+        Returns:
+            int: The tile id.
+        
+        Raises:
+            IndexError: If the cell is outside the map.
+        """
+    def render(self) -> None:
+        """
+        Render the chunks of the map that are visible through the active camera.
+        
+        Raises:
+            RuntimeError: If rendering fails.
+        """
+    def set_tile(self, col: typing.SupportsInt, row: typing.SupportsInt, tile_id: typing.SupportsInt) -> None:
+        """
+        Set the tile id at a grid cell and mark its chunk for rebuilding.
+        
+        Args:
+            col (int): The tile column.
+            row (int): The tile row.
+            tile_id (int): The new tile id. Negative ids are empty.
+        
+        Raises:
+            IndexError: If the cell is outside the map.
+        """
+    def set_tiles(self, tiles: typing.Annotated[numpy.typing.ArrayLike, numpy.int32]) -> None:
+        """
+        Replace the tile ids. Only chunks containing changed tiles are rebuilt.
+        
+        Args:
+            tiles (numpy.ndarray): Array with shape (rows, cols) of integer tile ids.
+        
+        Raises:
+            ValueError: If the array is not 2-dimensional.
+        """
+    @property
+    def cols(self) -> int:
+        """
+        The number of tile columns in the map.
+        """
+    @property
+    def pos(self) -> Vec2:
+        """
+        The world position of the map's top-left corner.
+        """
+    @pos.setter
+    def pos(self, arg0: Vec2) -> None:
+        ...
+    @property
+    def rows(self) -> int:
+        """
+        The number of tile rows in the map.
+        """
+    @property
+    def tile_size(self) -> Vec2:
+        """
+        Create a tile map.
+        
+        Args:
+            tileset (Texture): The texture containing the tile images laid out in a grid.
+            tile_size (Vec2): The size of a single tile in pixels as (width, height).
+            tiles (numpy.ndarray): Array with shape (rows, cols) of integer tile ids.
+            chunk_size (int, optional): The width and height of a chunk in tiles. Defaults to 16.
+        
+        Raises:
+            ValueError: If the tile size, chunk size or tiles array shape is invalid.
+        """
+    @property
+    def tiles(self) -> numpy.typing.NDArray[numpy.int32]:
+        """
+        Create a tile map.
+        
+        Args:
+            tileset (Texture): The texture containing the tile images laid out in a grid.
+            tile_size (Vec2): The size of a single tile in pixels as (width, height).
+            tiles (numpy.ndarray): Array with shape (rows, cols) of integer tile ids.
+            chunk_size (int, optional): The width and height of a chunk in tiles. Defaults to 16.
+        
+        Raises:
+            ValueError: If the tile size, chunk size or tiles array shape is invalid.
+        """
+    @property
+    def tileset(self) -> Texture:
+        """
+        Create a tile map.
+        
+        Args:
+            tileset (Texture): The texture containing the tile images laid out in a grid.
+            tile_size (Vec2): The size of a single tile in pixels as (width, height).
+            tiles (numpy.ndarray): Array with shape (rows, cols) of integer tile ids.
+            chunk_size (int, optional): The width and height of a chunk in tiles. Defaults to 16.
+        
+        Raises:
+            ValueError: If the tile size, chunk size or tiles array shape is invalid.
+        """
+    @tileset.setter
+    def tileset(self, arg0: Texture) -> None:
+        ...
 class Timer:
     """
     
@@ -2476,6 +3523,8 @@ DROP_COMPLETE: EventType  # value = <EventType.DROP_COMPLETE: 4099>
 DROP_FILE: EventType  # value = <EventType.DROP_FILE: 4096>
 DROP_POSITION: EventType  # value = <EventType.DROP_POSITION: 4100>
 DROP_TEXT: EventType  # value = <EventType.DROP_TEXT: 4097>
+EXACT: BlurQuality  # value = <BlurQuality.EXACT: 0>
+FAST: BlurQuality  # value = <BlurQuality.FAST: 1>
 GAMEPAD_ADDED: EventType  # value = <EventType.GAMEPAD_ADDED: 1619>
 GAMEPAD_AXIS_MOTION: EventType  # value = <EventType.GAMEPAD_AXIS_MOTION: 1616>
 GAMEPAD_BUTTON_DOWN: EventType  # value = <EventType.GAMEPAD_BUTTON_DOWN: 1617>
@@ -7,7 +7,7 @@ import numpy
 import numpy.typing
 import pykraken._core
 import typing
-__all__ = ['circle', 'line', 'point', 'points', 'points_from_ndarray', 'polygon', 'rect', 'rects']
+__all__ = ['circle', 'circles', 'circles_from_ndarray', 'ellipse', 'line', 'lines', 'lines_from_ndarray', 'point', 'points', 'points_from_ndarray', 'polygon', 'polygons', 'polygons_from_ndarray', 'rect', 'rects', 'rects_from_ndarray']
 def circle(circle: pykraken._core.Circle, color: pykraken._core.Color, thickness: typing.SupportsInt = 0) -> None:
     """
     Draw a circle to the renderer.
@@ -18,6 +18,42 @@ def circle(circle: pykraken._core.Circle, color: pykraken._core.Color, thickness
         thickness (int, optional): The line thickness. If 0 or >= radius, draws filled circle.
                                   Defaults to 0 (filled).
     """
+def circles(circles: collections.abc.Sequence[pykraken._core.Circle], color: pykraken._core.Color, thickness: typing.SupportsInt = 0) -> None:
+    """
+    Batch draw an array of circles to the renderer in a single geometry submission.
+    
+    Args:
+        circles (Sequence[Circle]): The circles to batch draw.
+        color (Color): The color of the circles.
+        thickness (int, optional): The line thickness. If 0 or >= radius, draws filled circles.
+                                  Defaults to 0 (filled).
+    """
+def circles_from_ndarray(circles: typing.Annotated[numpy.typing.ArrayLike, numpy.float64], color: pykraken._core.Color, thickness: typing.SupportsInt = 0, colors: typing.Any = None) -> None:
+    """
+    Batch draw circles from a NumPy array in a single geometry submission.
+    
+    Args:
+        circles (numpy.ndarray): Array with shape (N,3) containing x, y, radius values.
+        color (Color): The color of the circles.
+        thickness (int, optional): The line thickness. If 0 or >= radius, draws filled circles.
+                                  Defaults to 0 (filled).
+        colors (numpy.ndarray, optional): Array with shape (N,4) of per-circle RGBA uint8 values
+                                          that overrides color. Defaults to None.
+    
+    Raises:
+        ValueError: If an array shape is invalid.
+        RuntimeError: If circle rendering fails.
+    """
+def ellipse(rect: pykraken._core.Rect, color: pykraken._core.Color, thickness: typing.SupportsInt = 0) -> None:
+    """
+    Draw an ellipse inscribed in a rectangle to the renderer.
+    
+    Args:
+        rect (Rect): The bounding rectangle of the ellipse.
+        color (Color): The color of the ellipse.
+        thickness (int, optional): The line thickness. If 0 or >= the smaller radius, draws a
+                                  filled ellipse. Defaults to 0 (filled).
+    """
 def line(line: pykraken._core.Line, color: pykraken._core.Color, thickness: typing.SupportsInt = 1) -> None:
     """
     Draw a line to the renderer.
@@ -27,6 +63,33 @@ def line(line: pykraken._core.Line, color: pykraken._core.Color, thickness: typi
         color (Color): The color of the line.
         thickness (int, optional): The line thickness in pixels. Defaults to 1.
     """
+def lines(lines: collections.abc.Sequence[pykraken._core.Line], color: pykraken._core.Color, thickness: typing.SupportsInt = 1) -> None:
+    """
+    Batch draw an array of lines to the renderer in a single geometry submission.
+    
+    Args:
+        lines (Sequence[Line]): The lines to batch draw.
+        color (Color): The color of the lines.
+        thickness (int, optional): The line thickness. Defaults to 1.
+    
+    Raises:
+        RuntimeError: If line rendering fails.
+    """
+def lines_from_ndarray(lines: typing.Annotated[numpy.typing.ArrayLike, numpy.float64], color: pykraken._core.Color, thickness: typing.SupportsInt = 1, colors: typing.Any = None) -> None:
+    """
+    Batch draw lines from a NumPy array in a single geometry submission.
+    
+    Args:
+        lines (numpy.ndarray): Array with shape (N,4) containing ax, ay, bx, by values.
+        color (Color): The color of the lines.
+        thickness (int, optional): The line thickness. Defaults to 1.
+        colors (numpy.ndarray, optional): Array with shape (N,4) of per-line RGBA uint8 values
+                                          that overrides color. Defaults to None.
+    
+    Raises:
+        ValueError: If an array shape is invalid.
+        RuntimeError: If line rendering fails.
+    """
 def point(point: pykraken._core.Vec2, color: pykraken._core.Color) -> None:
     """
     Draw a single point to the renderer.
@@ -38,18 +101,21 @@ def point(point: pykraken._core.Vec2, color: pykraken._core.Color) -> None:
     Raises:
         RuntimeError: If point rendering fails.
     """
-def points(points: collections.abc.Sequence[pykraken._core.Vec2], color: pykraken._core.Color) -> None:
+def points(points: collections.abc.Sequence[pykraken._core.Vec2], color: pykraken._core.Color, colors: typing.Any = None) -> None:
     """
     Batch draw an array of points to the renderer.
     
     Args:
         points (Sequence[Vec2]): The points to batch draw.
         color (Color): The color of the points.
+        colors (numpy.ndarray, optional): Array with shape (N,4) of per-point RGBA uint8 values
+                                          that overrides color. Defaults to None.
     
     Raises:
+        ValueError: If the colors array shape is invalid.
         RuntimeError: If point rendering fails.
     """
-def points_from_ndarray(points: typing.Annotated[numpy.typing.ArrayLike, numpy.float64], color: pykraken._core.Color) -> None:
+def points_from_ndarray(points: typing.Annotated[numpy.typing.ArrayLike, numpy.float64], color: pykraken._core.Color, colors: typing.Any = None) -> None:
     """
     Batch draw points from a NumPy array.
     
@@ -60,9 +126,11 @@ def points_from_ndarray(points: typing.Annotated[numpy.typing.ArrayLike, numpy.f
     Args:
         points (numpy.ndarray): Array with shape (N,2) containing x,y coordinates.
         color (Color): The color of the points.
+        colors (numpy.ndarray, optional): Array with shape (N,4) of per-point RGBA uint8 values
+                                          that overrides color. Defaults to None.
     
     Raises:
-        ValueError: If the array shape is not (N,2).
+        ValueError: If an array shape is invalid.
         RuntimeError: If point rendering fails.
     """
 def polygon(polygon: pykraken._core.Polygon, color: pykraken._core.Color, filled: bool = False) -> None:
@@ -75,6 +143,40 @@ def polygon(polygon: pykraken._core.Polygon, color: pykraken._core.Color, filled
         filled (bool, optional): Whether to draw a filled polygon or just the outline.
                                  Defaults to False (outline). Works with both convex and concave polygons.
     """
+def polygons(polygons: collections.abc.Sequence[pykraken._core.Polygon], color: pykraken._core.Color, filled: bool = False) -> None:
+    """
+    Batch draw an array of polygons to the renderer in a single geometry submission.
+    
+    Args:
+        polygons (Sequence[Polygon]): The polygons to batch draw.
+        color (Color): The color of the polygons.
+        filled (bool, optional): Whether to draw filled polygons or just the outlines.
+                                 Defaults to False (outline). Filled polygons may be concave
+                                 but must not self-intersect.
+    
+    Raises:
+        RuntimeError: If polygon rendering fails.
+    """
+def polygons_from_ndarray(vertices: typing.Annotated[numpy.typing.ArrayLike, numpy.float64], offsets: typing.Annotated[numpy.typing.ArrayLike, numpy.int64], color: pykraken._core.Color, filled: bool = False, colors: typing.Any = None) -> None:
+    """
+    Batch draw polygons stored in a flat vertex array in a single geometry submission.
+    
+    Polygon i uses the vertices from offsets[i] up to offsets[i + 1], so K polygons need
+    K + 1 offsets starting at 0 and ending at the number of vertices.
+    
+    Args:
+        vertices (numpy.ndarray): Array with shape (M,2) containing x, y values.
+        offsets (numpy.ndarray): Array with shape (K+1,) of ascending vertex start indices.
+        color (Color): The color of the polygons.
+        filled (bool, optional): Whether to draw filled polygons or just the outlines.
+                                 Defaults to False (outline).
+        colors (numpy.ndarray, optional): Array with shape (K,4) of per-polygon RGBA uint8 values
+                                          that overrides color. Defaults to None.
+    
+    Raises:
+        ValueError: If an array shape or the offsets are invalid.
+        RuntimeError: If polygon rendering fails.
+    """
 def rect(rect: pykraken._core.Rect, color: pykraken._core.Color, thickness: typing.SupportsInt = 0) -> None:
     """
     Draw a rectangle to the renderer.
@@ -84,7 +186,7 @@ def rect(rect: pykraken._core.Rect, color: pykraken._core.Color, thickness: typi
         color (Color): The color of the rectangle.
         thickness (int, optional): The border thickness. If 0 or >= half width/height, draws filled rectangle. Defaults to 0 (filled).
     """
-def rects(rects: collections.abc.Sequence[pykraken._core.Rect], color: pykraken._core.Color, thickness: typing.SupportsInt = 0) -> None:
+def rects(rects: collections.abc.Sequence[pykraken._core.Rect], color: pykraken._core.Color, thickness: typing.SupportsInt = 0, colors: typing.Any = None) -> None:
     """
     Batch draw an array of rectangles to the renderer.
     
@@ -92,4 +194,23 @@ def rects(rects: collections.abc.Sequence[pykraken._core.Rect], color: pykraken.
         rects (Sequence[Rect]): The rectangles to batch draw.
         color (Color): The color of the rectangles.
         thickness (int, optional): The border thickness of the rectangles. If 0 or >= half width/height, draws filled rectangles. Defaults to 0 (filled).
+        colors (numpy.ndarray, optional): Array with shape (N,4) of per-rectangle RGBA uint8 values
+                                          that overrides color. Defaults to None.
+    
+    Raises:
+        ValueError: If the colors array shape is invalid.
+    """
+def rects_from_ndarray(rects: typing.Annotated[numpy.typing.ArrayLike, numpy.float64], color: pykraken._core.Color, colors: typing.Any = None) -> None:
+    """
+    Batch draw filled rectangles from a NumPy array in a single geometry submission.
+    
+    Args:
+        rects (numpy.ndarray): Array with shape (N,4) containing x, y, w, h values.
+        color (Color): The color of the rectangles.
+        colors (numpy.ndarray, optional): Array with shape (N,4) of per-rectangle RGBA uint8 values
+                                          that overrides color. Defaults to None.
+    
+    Raises:
+        ValueError: If an array shape is invalid.
+        RuntimeError: If rectangle rendering fails.
     """
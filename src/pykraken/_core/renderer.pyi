@@ -4,7 +4,18 @@ Functions for rendering graphics
 from __future__ import annotations
 import pykraken._core
 import typing
-__all__ = ['clear', 'get_res', 'present']
+__all__ = ['begin_batch', 'clear', 'end_batch', 'get_cull_stats', 'get_res', 'is_retained', 'mark_dirty', 'present', 'set_retained', 'set_target']
+def begin_batch() -> None:
+    """
+    Start batching texture draws.
+    
+    While a batch is active, Texture.render calls are queued instead of being drawn
+    immediately. Consecutive draws of the same texture and blend mode are submitted
+    together as a single geometry call when the batch is flushed.
+    
+    The batch is flushed automatically before any shape drawing, clearing, or presenting,
+    so draw order is preserved.
+    """
 @typing.overload
 def clear(color: typing.Any = None) -> None:
     """
@@ -27,6 +38,20 @@ def clear(r: typing.SupportsInt, g: typing.SupportsInt, b: typing.SupportsInt, a
         b (int): Blue component (0-255).
         a (int, optional): Alpha component (0-255). Defaults to 255.
     """
+def end_batch() -> None:
+    """
+    Flush all queued texture draws and stop batching.
+    """
+def get_cull_stats() -> tuple[int, int]:
+    """
+    Get the culling statistics of the last presented frame.
+    
+    Every draw call and texture render is tested against the visible area of the current
+    render target (and the dirty region in retained mode) before being submitted.
+    
+    Returns:
+        tuple[int, int]: The number of primitives drawn and culled as (drawn, culled).
+    """
 def get_res() -> pykraken._core.Vec2:
     """
     Get the resolution of the renderer.
@@ -34,6 +59,24 @@ def get_res() -> pykraken._core.Vec2:
     Returns:
         Vec2: The current rendering resolution as (width, height).
     """
+def is_retained() -> bool:
+    """
+    Check whether retained (partial redraw) mode is enabled.
+    
+    Returns:
+        bool: True if retained mode is enabled.
+    """
+def mark_dirty(rect: typing.Any = None) -> None:
+    """
+    Mark a region of the screen as needing a redraw this frame in retained mode.
+    
+    Args:
+        rect (Rect, optional): The world-space region to redraw. The active camera offset is
+                               applied. Defaults to the whole screen.
+    
+    Raises:
+        TypeError: If rect is not a Rect or None.
+    """
 def present() -> None:
     """
     Present the rendered content to the screen.
@@ -41,3 +84,32 @@ def present() -> None:
     This finalizes the current frame and displays it. Should be called after
     all drawing operations for the frame are complete.
     """
+def set_retained(retained: bool) -> None:
+    """
+    Enable or disable retained (partial redraw) mode.
+    
+    In retained mode the screen contents persist between frames. Only the regions marked
+    with mark_dirty() are redrawn: drawing is clipped to the union of the dirty regions,
+    clear() only clears that union, and present() does nothing when no drawing touched it.
+    This brings the cost of idle frames close to zero.
+    
+    Dirty regions come from mark_dirty() rather than from the draw calls themselves. When
+    an object moves or disappears, the pixels it left behind in an earlier frame must be
+    redrawn too, and only the caller knows where it was.
+    
+    Enabling retained mode marks the whole screen dirty once.
+    
+    Args:
+        retained (bool): True to enable retained mode, False to redraw fully every frame.
+    """
+def set_target(target: typing.Any = None) -> None:
+    """
+    Set the render target that subsequent drawing goes to.
+    
+    Args:
+        target (RenderTarget, optional): The target to draw into, or None to draw to the
+                                         screen again. Defaults to None.
+    
+    Raises:
+        TypeError: If target is not a RenderTarget or None.
+    """
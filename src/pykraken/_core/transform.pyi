@@ -2,29 +2,222 @@
 Functions for transforming pixel arrays
 """
 from __future__ import annotations
+import numpy
+import numpy.typing
 import pykraken._core
 import typing
-__all__ = ['box_blur', 'flip', 'gaussian_blur', 'grayscale', 'invert', 'rotate', 'scale_by', 'scale_to']
-def box_blur(pixel_array: pykraken._core.PixelArray, radius: typing.SupportsInt, repeat_edge_pixels: bool = True) -> pykraken._core.PixelArray:
+__all__ = ['Pipeline', 'box_blur', 'build_mips', 'flip', 'gaussian_blur', 'grayscale', 'invert', 'rotate', 'rotozoom', 'scale_by', 'scale_to']
+class Pipeline:
+    """
+    
+    A reusable chain of pixel operations applied in as few passes as possible.
+    
+    Operations are added with chainable methods and run in order by apply. Adjacent color
+    operations (invert, grayscale, brightness, contrast, color_matrix, tint, alpha_multiply)
+    are folded into a single color matrix, and every run of color and threshold operations
+    between blurs is applied in one pass over the pixels. Intermediate colors within a folded
+    matrix are not clamped. Color operations on a premultiplied pixel array work on its straight
+    colors, and the result is premultiplied again.
+    
+    Example:
+        flash = transform.Pipeline().grayscale().brightness(0.4).tint(Color(255, 80, 80))
+        flash.apply(sprite_pixels, dst=flash_pixels)
+        
+    """
+    def __init__(self) -> None:
+        """
+        Create an empty pipeline.
+        """
+    def alpha_multiply(self, factor: typing.SupportsFloat) -> Pipeline:
+        """
+        Add an operation that multiplies the alpha channel.
+        
+        Args:
+            factor (float): The alpha factor.
+        
+        Returns:
+            Pipeline: This pipeline, for chaining.
+        
+        Raises:
+            ValueError: If factor is negative.
+        """
+    def apply(self, pixel_array: pykraken._core.PixelArray, *, dst: typing.Any = None, inplace: bool = False) -> typing.Any:
+        """
+        Run the pipeline on a pixel array.
+        
+        Args:
+            pixel_array (PixelArray): The source pixel array.
+            dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                        when the size matches, otherwise it is reallocated.
+            inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
+        
+        Returns:
+            PixelArray: The result, in dst or pixel_array if given, otherwise a new pixel array.
+        
+        Raises:
+            ValueError: If both dst and inplace are given.
+            RuntimeError: If pixel array creation fails.
+        """
+    def box_blur(self, radius: typing.SupportsInt, repeat_edge_pixels: bool = True) -> Pipeline:
+        """
+        Add a box blur pass. See transform.box_blur.
+        
+        Args:
+            radius (int): The blur radius in pixels.
+            repeat_edge_pixels (bool, optional): Whether to repeat edge pixels when sampling
+                                                outside the bounds. Defaults to True.
+        
+        Returns:
+            Pipeline: This pipeline, for chaining.
+        
+        Raises:
+            ValueError: If radius is negative.
+        """
+    def brightness(self, amount: typing.SupportsFloat) -> Pipeline:
+        """
+        Add an operation that brightens or darkens the RGB channels.
+        
+        Args:
+            amount (float): The amount added to each channel, from -1.0 (black) to 1.0 (white).
+        
+        Returns:
+            Pipeline: This pipeline, for chaining.
+        """
+    def clear(self) -> None:
+        """
+        Remove all operations.
+        """
+    def color_matrix(self, matrix: typing.Annotated[numpy.typing.ArrayLike, numpy.float32]) -> Pipeline:
+        """
+        Add an operation that multiplies each RGBA color by a matrix.
+        
+        Each output channel is the dot product of a matrix row with the input (r, g, b, a), plus
+        the row's fifth element as an offset when given.
+        
+        Args:
+            matrix (numpy.ndarray | Sequence): A (4, 4) or (4, 5) matrix. Offsets are in the
+                                               0.0-1.0 range.
+        
+        Returns:
+            Pipeline: This pipeline, for chaining.
+        
+        Raises:
+            ValueError: If the matrix shape is invalid.
+        """
+    def contrast(self, factor: typing.SupportsFloat) -> Pipeline:
+        """
+        Add an operation that scales the RGB channels' distance from mid-gray.
+        
+        Args:
+            factor (float): The contrast factor. 1.0 leaves the image unchanged, values below 1.0
+                            reduce and values above 1.0 increase the contrast.
+        
+        Returns:
+            Pipeline: This pipeline, for chaining.
+        
+        Raises:
+            ValueError: If factor is negative.
+        """
+    def gaussian_blur(self, radius: typing.SupportsInt, repeat_edge_pixels: bool = True, quality: pykraken._core.BlurQuality = pykraken._core.BlurQuality.EXACT) -> Pipeline:
+        """
+        Add a Gaussian blur pass. See transform.gaussian_blur.
+        
+        Args:
+            radius (int): The blur radius in pixels.
+            repeat_edge_pixels (bool, optional): Whether to repeat edge pixels when sampling
+                                                outside the bounds. Defaults to True.
+            quality (BlurQuality, optional): The quality/speed trade-off. Defaults to EXACT.
+        
+        Returns:
+            Pipeline: This pipeline, for chaining.
+        
+        Raises:
+            ValueError: If radius is negative.
+        """
+    def grayscale(self) -> Pipeline:
+        """
+        Add an operation that converts to grayscale using the same weights as transform.grayscale.
+        
+        Returns:
+            Pipeline: This pipeline, for chaining.
+        """
+    def invert(self) -> Pipeline:
+        """
+        Add an operation that inverts the RGB channels.
+        
+        Returns:
+            Pipeline: This pipeline, for chaining.
+        """
+    def threshold(self, level: typing.SupportsInt) -> Pipeline:
+        """
+        Add an operation that sets each RGB channel to 255 if it is at least level, otherwise 0.
+        
+        Args:
+            level (int): The threshold level from 0 to 255.
+        
+        Returns:
+            Pipeline: This pipeline, for chaining.
+        
+        Raises:
+            ValueError: If level is out of range.
+        """
+    def tint(self, color: pykraken._core.Color) -> Pipeline:
+        """
+        Add an operation that multiplies each channel by a color.
+        
+        Args:
+            color (Color): The tint color. Its alpha multiplies the alpha channel.
+        
+        Returns:
+            Pipeline: This pipeline, for chaining.
+        """
+    @property
+    def pass_count(self) -> int:
+        """
+        The number of passes over the pixels apply performs, counting each blur as one.
+        """
+def box_blur(pixel_array: pykraken._core.PixelArray, radius: typing.SupportsInt, repeat_edge_pixels: bool = True, *, dst: typing.Any = None, inplace: bool = False) -> pykraken._core.PixelArray:
     """
     Apply a box blur effect to a pixel array.
     
     Box blur creates a uniform blur effect by averaging pixels within a square kernel.
     It's faster than Gaussian blur but produces a more uniform, less natural look.
+    The cost per pixel does not depend on the radius.
     
     Args:
         pixel_array (PixelArray): The pixel array to blur.
         radius (int): The blur radius in pixels. Larger values create stronger blur.
         repeat_edge_pixels (bool, optional): Whether to repeat edge pixels when sampling
-                                            outside the pixel array bounds. Defaults to True.
+                                            outside the pixel array bounds. Otherwise pixels
+                                            outside are transparent black. Defaults to True.
+        dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                    when the size matches, otherwise it is reallocated.
+        inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
     
     Returns:
-        PixelArray: A new pixel array with the box blur effect applied.
+        PixelArray: The blurred image, in dst or pixel_array if given, otherwise a new pixel array.
     
     Raises:
+        ValueError: If radius is negative, or if both dst and inplace are given.
         RuntimeError: If pixel array creation fails during the blur process.
     """
-def flip(pixel_array: pykraken._core.PixelArray, flip_x: bool, flip_y: bool) -> pykraken._core.PixelArray:
+def build_mips(pixel_array: pykraken._core.PixelArray) -> list:
+    """
+    Build a mip chain of successively half-size copies of a pixel array.
+    
+    Each level is the area average of the one before it, computed on worker threads with SIMD
+    instructions where available. Odd sizes round down, and the chain ends at 1x1.
+    
+    Args:
+        pixel_array (PixelArray): The full-size image, which becomes level 0.
+    
+    Returns:
+        list[PixelArray]: The levels from largest to smallest, starting with pixel_array itself.
+    
+    Raises:
+        RuntimeError: If pixel array creation fails.
+    """
+def flip(pixel_array: pykraken._core.PixelArray, flip_x: bool, flip_y: bool, *, dst: typing.Any = None, inplace: bool = False) -> pykraken._core.PixelArray:
     """
     Flip a pixel array horizontally, vertically, or both.
     
@@ -32,14 +225,18 @@ def flip(pixel_array: pykraken._core.PixelArray, flip_x: bool, flip_y: bool) ->
         pixel_array (PixelArray): The pixel array to flip.
         flip_x (bool): Whether to flip horizontally (mirror left-right).
         flip_y (bool): Whether to flip vertically (mirror top-bottom).
+        dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                    when the size matches, otherwise it is reallocated.
+        inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
     
     Returns:
-        PixelArray: A new pixel array with the flipped image.
+        PixelArray: The flipped image, in dst or pixel_array if given, otherwise a new pixel array.
     
     Raises:
+        ValueError: If both dst and inplace are given.
         RuntimeError: If pixel array creation fails.
     """
-def gaussian_blur(pixel_array: pykraken._core.PixelArray, radius: typing.SupportsInt, repeat_edge_pixels: bool = True) -> pykraken._core.PixelArray:
+def gaussian_blur(pixel_array: pykraken._core.PixelArray, radius: typing.SupportsInt, repeat_edge_pixels: bool = True, quality: pykraken._core.BlurQuality = pykraken._core.BlurQuality.EXACT, *, dst: typing.Any = None, inplace: bool = False) -> pykraken._core.PixelArray:
     """
     Apply a Gaussian blur effect to a pixel array.
     
@@ -47,19 +244,28 @@ def gaussian_blur(pixel_array: pykraken._core.PixelArray, radius: typing.Support
     for pixel weighting. It produces higher quality results than box blur but is
     computationally more expensive.
     
+    With BlurQuality.EXACT the full kernel is applied, so the cost grows with the radius.
+    BlurQuality.FAST approximates the Gaussian with three successive box blurs whose cost
+    does not depend on the radius, which suits large radii.
+    
     Args:
         pixel_array (PixelArray): The pixel array to blur.
         radius (int): The blur radius in pixels. Larger values create stronger blur.
         repeat_edge_pixels (bool, optional): Whether to repeat edge pixels when sampling
                                             outside the pixel array bounds. Defaults to True.
+        quality (BlurQuality, optional): The quality/speed trade-off. Defaults to EXACT.
+        dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                    when the size matches, otherwise it is reallocated.
+        inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
     
     Returns:
-        PixelArray: A new pixel array with the Gaussian blur effect applied.
+        PixelArray: The blurred image, in dst or pixel_array if given, otherwise a new pixel array.
     
     Raises:
+        ValueError: If radius is negative, or if both dst and inplace are given.
         RuntimeError: If pixel array creation fails during the blur process.
     """
-def grayscale(pixel_array: pykraken._core.PixelArray) -> pykraken._core.PixelArray:
+def grayscale(pixel_array: pykraken._core.PixelArray, *, dst: typing.Any = None, inplace: bool = False) -> pykraken._core.PixelArray:
     """
     Convert a pixel array to grayscale.
     
@@ -71,45 +277,89 @@ def grayscale(pixel_array: pykraken._core.PixelArray) -> pykraken._core.PixelArr
     
     Args:
         pixel_array (PixelArray): The pixel array to convert to grayscale.
+        dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                    when the size matches, otherwise it is reallocated.
+        inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
     
     Returns:
-        PixelArray: A new pixel array converted to grayscale.
+        PixelArray: The grayscale image, in dst or pixel_array if given, otherwise a new pixel
+                    array.
     
     Raises:
+        ValueError: If both dst and inplace are given.
         RuntimeError: If pixel array creation fails.
     """
-def invert(pixel_array: pykraken._core.PixelArray) -> pykraken._core.PixelArray:
+def invert(pixel_array: pykraken._core.PixelArray, *, dst: typing.Any = None, inplace: bool = False) -> pykraken._core.PixelArray:
     """
     Invert the colors of a pixel array.
     
     Creates a negative image effect by inverting each color channel (RGB).
-    The alpha channel is preserved unchanged.
+    The alpha channel is preserved unchanged. Premultiplied colors are inverted against
+    their alpha, so the result stays premultiplied.
     
     Args:
         pixel_array (PixelArray): The pixel array to invert.
+        dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                    when the size matches, otherwise it is reallocated.
+        inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
     
     Returns:
-        PixelArray: A new pixel array with inverted colors.
+        PixelArray: The inverted image, in dst or pixel_array if given, otherwise a new pixel array.
     
     Raises:
+        ValueError: If both dst and inplace are given.
         RuntimeError: If pixel array creation fails.
     """
-def rotate(pixel_array: pykraken._core.PixelArray, angle: typing.SupportsFloat) -> pykraken._core.PixelArray:
+def rotate(pixel_array: pykraken._core.PixelArray, angle: typing.SupportsFloat, smooth: bool = False, *, dst: typing.Any = None, inplace: bool = False) -> pykraken._core.PixelArray:
     """
     Rotate a pixel array by a given angle.
     
     Args:
         pixel_array (PixelArray): The pixel array to rotate.
-        angle (float): The rotation angle in degrees. Positive values rotate clockwise.
+        angle (float): The rotation angle in degrees. Positive values rotate counter-clockwise.
+                       Multiples of 90 are exact and keep the image's size (or swap its width
+                       and height).
+        smooth (bool, optional): Whether to filter with bilinear interpolation instead of taking
+                                 the nearest pixel. Defaults to False.
+        dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                    when the size matches, otherwise it is reallocated.
+        inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
+    
+    Returns:
+        PixelArray: The rotated image, in dst or pixel_array if given, otherwise a new pixel array.
+                    The output is sized to the rotated image's bounding box, and pixels outside
+                    the source are transparent.
+    
+    Raises:
+        ValueError: If both dst and inplace are given.
+        RuntimeError: If pixel array creation fails.
+    """
+def rotozoom(pixel_array: pykraken._core.PixelArray, angle: typing.SupportsFloat, scale: typing.SupportsFloat, smooth: bool = True, *, dst: typing.Any = None, inplace: bool = False) -> pykraken._core.PixelArray:
+    """
+    Rotate and scale a pixel array in a single pass.
+    
+    The work is split across worker threads, and bilinear filtering uses SIMD instructions
+    where available.
+    
+    Args:
+        pixel_array (PixelArray): The pixel array to transform.
+        angle (float): The rotation angle in degrees. Positive values rotate counter-clockwise.
+        scale (float): The scale factor (must be > 0).
+        smooth (bool, optional): Whether to filter with bilinear interpolation instead of taking
+                                 the nearest pixel. Defaults to True.
+        dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                    when the size matches, otherwise it is reallocated.
+        inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
     
     Returns:
-        PixelArray: A new pixel array containing the rotated image. The output pixel array may be
-                larger than the input to accommodate the rotated image.
+        PixelArray: The transformed image, in dst or pixel_array if given, otherwise a new pixel
+                    array sized to the transformed image's bounding box.
     
     Raises:
-        RuntimeError: If pixel array rotation fails.
+        ValueError: If scale is <= 0, or if both dst and inplace are given.
+        RuntimeError: If pixel array creation fails.
     """
-def scale_by(pixel_array: pykraken._core.PixelArray, factor: typing.SupportsFloat) -> pykraken._core.PixelArray:
+def scale_by(pixel_array: pykraken._core.PixelArray, factor: typing.SupportsFloat, smooth: bool = False, *, dst: typing.Any = None, inplace: bool = False) -> pykraken._core.PixelArray:
     """
     Scale a pixel array by a given factor.
     
@@ -117,25 +367,36 @@ def scale_by(pixel_array: pykraken._core.PixelArray, factor: typing.SupportsFloa
         pixel_array (PixelArray): The pixel array to scale.
         factor (float): The scaling factor (must be > 0). Values > 1.0 enlarge,
                        values < 1.0 shrink the pixel array.
+        smooth (bool, optional): Whether to average the source pixels covered by each output pixel
+                                 instead of taking the nearest one. Defaults to False.
+        dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                    when the size matches, otherwise it is reallocated.
+        inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
     
     Returns:
-        PixelArray: A new pixel array scaled by the specified factor.
+        PixelArray: The scaled image, in dst or pixel_array if given, otherwise a new pixel array.
     
     Raises:
-        ValueError: If factor is <= 0.
+        ValueError: If factor is <= 0, or if both dst and inplace are given.
         RuntimeError: If pixel array creation or scaling fails.
     """
-def scale_to(pixel_array: pykraken._core.PixelArray, size: pykraken._core.Vec2) -> pykraken._core.PixelArray:
+def scale_to(pixel_array: pykraken._core.PixelArray, size: pykraken._core.Vec2, smooth: bool = False, *, dst: typing.Any = None, inplace: bool = False) -> pykraken._core.PixelArray:
     """
     Scale a pixel array to a new exact size.
     
     Args:
         pixel_array (PixelArray): The pixel array to scale.
         size (Vec2): The target size as (width, height).
+        smooth (bool, optional): Whether to average the source pixels covered by each output pixel
+                                 instead of taking the nearest one. Defaults to False.
+        dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                    when the size matches, otherwise it is reallocated.
+        inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
     
     Returns:
-        PixelArray: A new pixel array scaled to the specified size.
+        PixelArray: The scaled image, in dst or pixel_array if given, otherwise a new pixel array.
     
     Raises:
+        ValueError: If both dst and inplace are given.
         RuntimeError: If pixel array creation or scaling fails.
     """
@@ -0,0 +1,79 @@
+#include "RenderTarget.hpp"
+#include "Math.hpp"
+#include "Renderer.hpp"
+
+#include <stdexcept>
+#include <string>
+
+static SDL_Texture* _createTargetTexture(const Vec2& size);
+
+namespace render_target
+{
+void _bind(py::module_& module)
+{
+    py::classh<RenderTarget, Texture>(module, "RenderTarget", R"doc(
+A texture that can be drawn into, then rendered like any other Texture.
+
+Use it to render static layers such as backgrounds, UI panels or lighting maps once
+and reuse them across frames. Drawing is redirected into the target either with
+renderer.set_target() or by using the target as a context manager:
+
+    with target:
+        kn.renderer.clear()
+        ...  # draw calls go into the target
+
+The previous target is restored when the block exits.
+    )doc")
+        .def(py::init<const Vec2&>(), py::arg("size"), R"doc(
+Create a transparent render target.
+
+Args:
+    size (Vec2): The size of the target as (width, height).
+
+Raises:
+    ValueError: If either dimension is not positive.
+    RuntimeError: If target texture creation fails.
+        )doc")
+        .def(
+            "__enter__",
+            [](RenderTarget& self) -> RenderTarget&
+            {
+                renderer::pushTarget(self.getSDL());
+                return self;
+            },
+            py::return_value_policy::reference, R"doc(
+Redirect drawing into this target until the block exits.
+        )doc")
+        .def(
+            "__exit__", [](RenderTarget&, const py::args&) { renderer::popTarget(); },
+            R"doc(
+Restore the render target that was active before entering the block.
+        )doc");
+}
+} // namespace render_target
+
+RenderTarget::RenderTarget(const Vec2& size) : Texture(_createTargetTexture(size))
+{
+    // Target textures start with undefined contents
+    renderer::pushTarget(getSDL());
+    SDL_SetRenderDrawColor(renderer::get(), 0, 0, 0, 0);
+    SDL_RenderClear(renderer::get());
+    renderer::popTarget();
+}
+
+RenderTarget::~RenderTarget() { renderer::_releaseTarget(getSDL()); }
+
+SDL_Texture* _createTargetTexture(const Vec2& size)
+{
+    if (size.x <= 0 || size.y <= 0)
+        throw std::invalid_argument("Render target size must be positive");
+
+    SDL_Texture* texture =
+        SDL_CreateTexture(renderer::get(), SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET,
+                          static_cast<int>(size.x), static_cast<int>(size.y));
+    if (!texture)
+        throw std::runtime_error("Failed to create render target: " + std::string(SDL_GetError()));
+
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    return texture;
+}
@@ -1,10 +1,34 @@
 #include "Renderer.hpp"
+#include "Batch.hpp"
+#include "Camera.hpp"
 #include "Color.hpp"
 #include "Math.hpp"
+#include "Rect.hpp"
+#include "RenderTarget.hpp"
 #include "Window.hpp"
 
+#include <algorithm>
+#include <pybind11/stl.h>
+#include <vector>
+
 static SDL_Renderer* _renderer = nullptr;
 static SDL_Texture* _target = nullptr;
+static std::vector<SDL_Texture*> _targetStack;
+
+// Retained mode state: the union of this frame's dirty rects clips the screen target
+static bool _retained = false;
+static bool _changed = false;
+static bool _screenInvalid = false;
+static bool _hasDirty = false;
+static SDL_FRect _dirtyUnion = {0.f, 0.f, 0.f, 0.f};
+
+// Primitives submitted and culled in the current and the last presented frame
+static int _drawnCount = 0;
+static int _culledCount = 0;
+static std::pair<int, int> _lastCullStats = {0, 0};
+
+static void _bindCurrentTarget();
+static void _applyDirtyClip();
 
 namespace renderer
 {
@@ -41,6 +65,78 @@ This finalizes the current frame and displays it. Should be called after
 all drawing operations for the frame are complete.
     )doc");
 
+    subRenderer.def("begin_batch", &batch::begin, R"doc(
+Start batching texture draws.
+
+While a batch is active, Texture.render calls are queued instead of being drawn
+immediately. Consecutive draws of the same texture and blend mode are submitted
+together as a single geometry call when the batch is flushed.
+
+The batch is flushed automatically before any shape drawing, clearing, or presenting,
+so draw order is preserved.
+    )doc");
+
+    subRenderer.def("end_batch", &batch::end, R"doc(
+Flush all queued texture draws and stop batching.
+    )doc");
+
+    subRenderer.def("set_target", &setTarget, py::arg("target") = py::none(), R"doc(
+Set the render target that subsequent drawing goes to.
+
+Args:
+    target (RenderTarget, optional): The target to draw into, or None to draw to the
+                                     screen again. Defaults to None.
+
+Raises:
+    TypeError: If target is not a RenderTarget or None.
+    )doc");
+
+    subRenderer.def("set_retained", &setRetained, py::arg("retained"), R"doc(
+Enable or disable retained (partial redraw) mode.
+
+In retained mode the screen contents persist between frames. Only the regions marked
+with mark_dirty() are redrawn: drawing is clipped to the union of the dirty regions,
+clear() only clears that union, and present() does nothing when no drawing touched it.
+This brings the cost of idle frames close to zero.
+
+Dirty regions come from mark_dirty() rather than from the draw calls themselves. When
+an object moves or disappears, the pixels it left behind in an earlier frame must be
+redrawn too, and only the caller knows where it was.
+
+Enabling retained mode marks the whole screen dirty once.
+
+Args:
+    retained (bool): True to enable retained mode, False to redraw fully every frame.
+    )doc");
+
+    subRenderer.def("is_retained", &isRetained, R"doc(
+Check whether retained (partial redraw) mode is enabled.
+
+Returns:
+    bool: True if retained mode is enabled.
+    )doc");
+
+    subRenderer.def("mark_dirty", &markDirty, py::arg("rect") = py::none(), R"doc(
+Mark a region of the screen as needing a redraw this frame in retained mode.
+
+Args:
+    rect (Rect, optional): The world-space region to redraw. The active camera offset is
+                           applied. Defaults to the whole screen.
+
+Raises:
+    TypeError: If rect is not a Rect or None.
+    )doc");
+
+    subRenderer.def("get_cull_stats", &getCullStats, R"doc(
+Get the culling statistics of the last presented frame.
+
+Every draw call and texture render is tested against the visible area of the current
+render target (and the dirty region in retained mode) before being submitted.
+
+Returns:
+    tuple[int, int]: The number of primitives drawn and culled as (drawn, culled).
+    )doc");
+
     subRenderer.def("get_res", &getResolution, R"doc(
 Get the resolution of the renderer.
 
@@ -67,6 +163,11 @@ void init(SDL_Window* window, const Vec2& resolution)
 
 void quit()
 {
+    batch::end();
+    _targetStack.clear();
+    _retained = false;
+    _hasDirty = false;
+
     if (_renderer)
     {
         SDL_DestroyRenderer(_renderer);
@@ -92,26 +193,218 @@ void clear(py::object color)
     if (!knColor._isValid())
         throw std::invalid_argument("Color values must be between 0 and 255");
 
-    SDL_SetRenderDrawColor(_renderer, knColor.r, knColor.g, knColor.b, knColor.a);
-    SDL_RenderClear(_renderer);
+    clear(knColor.r, knColor.g, knColor.b, knColor.a);
 }
 
 void clear(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
+    batch::flush();
     SDL_SetRenderDrawColor(_renderer, r, g, b, a);
-    SDL_RenderClear(_renderer);
+
+    if (!_retained || !_targetStack.empty())
+    {
+        SDL_RenderClear(_renderer);
+        return;
+    }
+
+    // SDL_RenderClear ignores the clip rect, so only overwrite the dirty region
+    if (!_hasDirty)
+        return;
+
+    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+    SDL_GetRenderDrawBlendMode(_renderer, &blendMode);
+    SDL_SetRenderDrawBlendMode(_renderer, SDL_BLENDMODE_NONE);
+    SDL_RenderFillRect(_renderer, &_dirtyUnion);
+    SDL_SetRenderDrawBlendMode(_renderer, blendMode);
+    _changed = true;
 }
 
 Vec2 getResolution() { return {_target->w, _target->h}; }
 
 void present()
 {
-    SDL_SetRenderTarget(_renderer, nullptr);
-    SDL_RenderTexture(_renderer, _target, nullptr, nullptr);
-    SDL_RenderPresent(_renderer);
-    SDL_SetRenderTarget(_renderer, _target);
+    batch::flush();
+
+    if (!_retained || _changed || _screenInvalid)
+    {
+        SDL_SetRenderTarget(_renderer, nullptr);
+        SDL_RenderTexture(_renderer, _target, nullptr, nullptr);
+        SDL_RenderPresent(_renderer);
+        _bindCurrentTarget();
+    }
+
+    _lastCullStats = {_drawnCount, _culledCount};
+    _drawnCount = 0;
+    _culledCount = 0;
+
+    _changed = false;
+    _screenInvalid = false;
+    if (_retained)
+    {
+        _hasDirty = false;
+        _applyDirtyClip();
+    }
 }
 
+void setTarget(py::object target)
+{
+    SDL_Texture* sdlTarget = nullptr;
+    if (!target.is_none())
+    {
+        try
+        {
+            sdlTarget = target.cast<RenderTarget&>().getSDL();
+        }
+        catch (const py::cast_error&)
+        {
+            throw py::type_error("'target' must be a RenderTarget or None");
+        }
+    }
+
+    batch::flush();
+    _targetStack.clear();
+    if (sdlTarget)
+        _targetStack.push_back(sdlTarget);
+    _bindCurrentTarget();
+}
+
+void pushTarget(SDL_Texture* target)
+{
+    batch::flush();
+    _targetStack.push_back(target);
+    _bindCurrentTarget();
+}
+
+void popTarget()
+{
+    batch::flush();
+    if (!_targetStack.empty())
+        _targetStack.pop_back();
+    _bindCurrentTarget();
+}
+
+void _releaseTarget(SDL_Texture* target)
+{
+    const auto it = std::remove(_targetStack.begin(), _targetStack.end(), target);
+    if (it == _targetStack.end())
+        return;
+
+    batch::flush();
+    _targetStack.erase(it, _targetStack.end());
+    _bindCurrentTarget();
+}
+
+void setRetained(const bool retained)
+{
+    if (retained == _retained)
+        return;
+
+    batch::flush();
+    _retained = retained;
+    _changed = false;
+    _hasDirty = false;
+    if (retained)
+        markDirty(py::none());
+    else
+        _applyDirtyClip();
+}
+
+bool isRetained() { return _retained; }
+
+void markDirty(py::object rect)
+{
+    SDL_FRect dirty = {0.f, 0.f, static_cast<float>(_target->w), static_cast<float>(_target->h)};
+    if (!rect.is_none())
+    {
+        Rect knRect;
+        try
+        {
+            knRect = rect.cast<Rect>();
+        }
+        catch (const py::cast_error&)
+        {
+            throw py::type_error("'rect' must be a Rect or None");
+        }
+
+        const Vec2 cameraPos = camera::getActivePos();
+        knRect.x -= cameraPos.x;
+        knRect.y -= cameraPos.y;
+        dirty = knRect;
+    }
+
+    if (!_retained || dirty.w <= 0.f || dirty.h <= 0.f)
+        return;
+
+    batch::flush();
+    if (_hasDirty)
+        SDL_GetRectUnionFloat(&_dirtyUnion, &dirty, &_dirtyUnion);
+    else
+        _dirtyUnion = dirty;
+    _hasDirty = true;
+    _applyDirtyClip();
+}
+
+Vec2 _viewSize()
+{
+    const SDL_Texture* current = _targetStack.empty() ? _target : _targetStack.back();
+    return {current->w, current->h};
+}
+
+bool _submit(const SDL_FRect& bounds)
+{
+    const Vec2 size = _viewSize();
+    const SDL_FRect view = {0.f, 0.f, static_cast<float>(size.x), static_cast<float>(size.y)};
+
+    const bool visible = SDL_HasRectIntersectionFloat(&bounds, &view) &&
+                         (!_retained || !_targetStack.empty() ||
+                          (_hasDirty && SDL_HasRectIntersectionFloat(&bounds, &_dirtyUnion)));
+    if (!visible)
+    {
+        ++_culledCount;
+        return false;
+    }
+
+    ++_drawnCount;
+    if (_retained && _targetStack.empty())
+        _changed = true;
+    return true;
+}
+
+std::pair<int, int> getCullStats() { return _lastCullStats; }
+
+void _invalidateScreen() { _screenInvalid = true; }
+
 SDL_Renderer* get() { return _renderer; }
 
 } // namespace renderer
+
+void _applyDirtyClip()
+{
+    // Clip state belongs to the target, so it must be set while the screen target is bound
+    if (!_targetStack.empty())
+        SDL_SetRenderTarget(_renderer, _target);
+
+    if (!_retained)
+        SDL_SetRenderClipRect(_renderer, nullptr);
+    else
+    {
+        SDL_Rect clip = {0, 0, 0, 0};
+        if (_hasDirty)
+        {
+            const auto x0 = static_cast<int>(SDL_floorf(_dirtyUnion.x));
+            const auto y0 = static_cast<int>(SDL_floorf(_dirtyUnion.y));
+            const auto x1 = static_cast<int>(SDL_ceilf(_dirtyUnion.x + _dirtyUnion.w));
+            const auto y1 = static_cast<int>(SDL_ceilf(_dirtyUnion.y + _dirtyUnion.h));
+            clip = {x0, y0, x1 - x0, y1 - y0};
+        }
+        SDL_SetRenderClipRect(_renderer, &clip);
+    }
+
+    if (!_targetStack.empty())
+        _bindCurrentTarget();
+}
+
+void _bindCurrentTarget()
+{
+    SDL_SetRenderTarget(_renderer, _targetStack.empty() ? _target : _targetStack.back());
+}
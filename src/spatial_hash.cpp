@@ -0,0 +1,419 @@
+#include "SpatialHash.hpp"
+#include "Circle.hpp"
+#include "Math.hpp"
+#include "Rect.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+static uint64_t _cellKey(int cellX, int cellY);
+static py::array_t<int64_t> _toArray(const std::vector<int64_t>& ids);
+
+namespace spatial_hash
+{
+void _bind(py::module_& module)
+{
+    py::classh<SpatialHash>(module, "SpatialHash", R"doc(
+A uniform grid for finding overlapping rectangles and circles without testing every pair.
+
+Each shape is stored by integer id as its axis-aligned bounding box. The grid is rebuilt
+lazily on the next query, and only when a shape has moved into different cells. Cells
+should be about the size of a typical shape: much smaller cells make large shapes span
+many cells, and much larger cells put many shapes in each cell.
+    )doc")
+        .def(py::init<double>(), py::arg("cell_size") = 64.0, R"doc(
+Create an empty spatial hash.
+
+Args:
+    cell_size (float, optional): The width and height of a grid cell. Defaults to 64.
+
+Raises:
+    ValueError: If cell_size is not positive.
+        )doc")
+
+        .def_property_readonly("cell_size", &SpatialHash::getCellSize, R"doc(
+The width and height of a grid cell.
+        )doc")
+
+        .def("insert", py::overload_cast<int64_t, const Rect&>(&SpatialHash::insert),
+             py::arg("id"), py::arg("rect"), R"doc(
+Add a rectangle.
+
+Args:
+    id (int): The id to store the rectangle under.
+    rect (Rect): The rectangle's bounds.
+
+Raises:
+    ValueError: If the id is already in the hash.
+        )doc")
+        .def("insert", py::overload_cast<int64_t, const Circle&>(&SpatialHash::insert),
+             py::arg("id"), py::arg("circle"), R"doc(
+Add a circle, stored as its bounding box.
+
+Args:
+    id (int): The id to store the circle under.
+    circle (Circle): The circle.
+
+Raises:
+    ValueError: If the id is already in the hash.
+        )doc")
+        .def("move", py::overload_cast<int64_t, const Rect&>(&SpatialHash::move),
+             py::arg("id"), py::arg("rect"), R"doc(
+Update the bounds stored under an id.
+
+Args:
+    id (int): The id of the shape to move.
+    rect (Rect): The new bounds.
+
+Raises:
+    KeyError: If the id is not in the hash.
+        )doc")
+        .def("move", py::overload_cast<int64_t, const Circle&>(&SpatialHash::move),
+             py::arg("id"), py::arg("circle"), R"doc(
+Update the bounds stored under an id to those of a circle.
+
+Args:
+    id (int): The id of the shape to move.
+    circle (Circle): The new circle.
+
+Raises:
+    KeyError: If the id is not in the hash.
+        )doc")
+        .def("remove", &SpatialHash::remove, py::arg("id"), R"doc(
+Remove the shape stored under an id.
+
+Args:
+    id (int): The id of the shape to remove.
+
+Raises:
+    KeyError: If the id is not in the hash.
+        )doc")
+        .def("clear", &SpatialHash::clear, R"doc(
+Remove every shape.
+        )doc")
+
+        .def("query_rect", &SpatialHash::queryRect, py::arg("rect"), R"doc(
+Find the shapes whose bounds overlap a rectangle.
+
+Args:
+    rect (Rect): The region to search.
+
+Returns:
+    numpy.ndarray: Array with shape (N,) of the matching ids.
+        )doc")
+        .def("query_point", &SpatialHash::queryPoint, py::arg("point"), R"doc(
+Find the shapes whose bounds contain a point, including their edges.
+
+Args:
+    point (Vec2): The point to test.
+
+Returns:
+    numpy.ndarray: Array with shape (N,) of the matching ids.
+        )doc")
+        .def("query_circle", &SpatialHash::queryCircle, py::arg("circle"), R"doc(
+Find the shapes whose bounds touch a circle.
+
+Args:
+    circle (Circle): The region to search.
+
+Returns:
+    numpy.ndarray: Array with shape (N,) of the matching ids.
+        )doc")
+        .def("query_pairs", &SpatialHash::queryPairs, R"doc(
+Find every pair of shapes whose bounds overlap.
+
+Each pair is reported once, with the smaller id first. Bounds that only touch at an
+edge do not overlap, matching Rect.collide_rect.
+
+Returns:
+    numpy.ndarray: Array with shape (K,2) of overlapping id pairs.
+        )doc")
+
+        .def("__len__", &SpatialHash::getCount)
+        .def("__contains__", &SpatialHash::contains, py::arg("id"));
+}
+} // namespace spatial_hash
+
+SpatialHash::SpatialHash(const double cellSize) : m_cellSize(cellSize)
+{
+    if (!(cellSize > 0.0))
+        throw std::invalid_argument("Cell size must be positive");
+
+    m_invCellSize = 1.0 / cellSize;
+}
+
+void SpatialHash::insert(const int64_t id, const Rect& rect)
+{
+    add(id, {std::min(rect.x, rect.x + rect.w), std::min(rect.y, rect.y + rect.h),
+             std::max(rect.x, rect.x + rect.w), std::max(rect.y, rect.y + rect.h)});
+}
+
+void SpatialHash::insert(const int64_t id, const Circle& circle)
+{
+    const double radius = std::abs(circle.radius);
+    add(id, {circle.pos.x - radius, circle.pos.y - radius, circle.pos.x + radius,
+             circle.pos.y + radius});
+}
+
+void SpatialHash::move(const int64_t id, const Rect& rect)
+{
+    update(id, {std::min(rect.x, rect.x + rect.w), std::min(rect.y, rect.y + rect.h),
+                std::max(rect.x, rect.x + rect.w), std::max(rect.y, rect.y + rect.h)});
+}
+
+void SpatialHash::move(const int64_t id, const Circle& circle)
+{
+    const double radius = std::abs(circle.radius);
+    update(id, {circle.pos.x - radius, circle.pos.y - radius, circle.pos.x + radius,
+                circle.pos.y + radius});
+}
+
+void SpatialHash::remove(const int64_t id)
+{
+    const auto it = m_slots.find(id);
+    if (it == m_slots.end())
+        throw py::key_error("No shape with id " + std::to_string(id));
+
+    // Fill the hole with the last entry to keep the array dense
+    const int slot = it->second;
+    m_slots.erase(it);
+    if (slot != static_cast<int>(m_entries.size()) - 1)
+    {
+        m_entries[slot] = m_entries.back();
+        m_slots[m_entries[slot].id] = slot;
+    }
+    m_entries.pop_back();
+    m_dirty = true;
+}
+
+void SpatialHash::clear()
+{
+    m_entries.clear();
+    m_slots.clear();
+    m_cells.clear();
+    m_dirty = false;
+}
+
+bool SpatialHash::contains(const int64_t id) const { return m_slots.count(id) > 0; }
+
+size_t SpatialHash::getCount() const { return m_entries.size(); }
+
+double SpatialHash::getCellSize() const { return m_cellSize; }
+
+py::array_t<int64_t> SpatialHash::queryRect(const Rect& rect) const
+{
+    const Box region = {std::min(rect.x, rect.x + rect.w), std::min(rect.y, rect.y + rect.h),
+                        std::max(rect.x, rect.x + rect.w), std::max(rect.y, rect.y + rect.h)};
+
+    std::vector<int64_t> ids;
+    forEachInBox(region,
+                 [&](const int slot)
+                 {
+                     const Box& box = m_entries[slot].box;
+                     if (box.minX < region.maxX && box.maxX > region.minX &&
+                         box.minY < region.maxY && box.maxY > region.minY)
+                         ids.push_back(m_entries[slot].id);
+                 });
+    return _toArray(ids);
+}
+
+py::array_t<int64_t> SpatialHash::queryPoint(const Vec2& point) const
+{
+    std::vector<int64_t> ids;
+    forEachInBox({point.x, point.y, point.x, point.y},
+                 [&](const int slot) { ids.push_back(m_entries[slot].id); });
+    return _toArray(ids);
+}
+
+py::array_t<int64_t> SpatialHash::queryCircle(const Circle& circle) const
+{
+    const double radius = std::abs(circle.radius);
+    const Box region = {circle.pos.x - radius, circle.pos.y - radius, circle.pos.x + radius,
+                        circle.pos.y + radius};
+
+    std::vector<int64_t> ids;
+    forEachInBox(region,
+                 [&](const int slot)
+                 {
+                     const Box& box = m_entries[slot].box;
+                     const double dx = circle.pos.x - std::clamp(circle.pos.x, box.minX, box.maxX);
+                     const double dy = circle.pos.y - std::clamp(circle.pos.y, box.minY, box.maxY);
+                     if (dx * dx + dy * dy <= radius * radius)
+                         ids.push_back(m_entries[slot].id);
+                 });
+    return _toArray(ids);
+}
+
+py::array_t<int64_t> SpatialHash::queryPairs() const
+{
+    rebuild();
+
+    std::vector<int64_t> pairs;
+    for (size_t begin = 0; begin < m_cells.size();)
+    {
+        const uint64_t key = m_cells[begin].key;
+        size_t end = begin + 1;
+        while (end < m_cells.size() && m_cells[end].key == key)
+            ++end;
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            const Entry& a = m_entries[m_cells[i].slot];
+            for (size_t j = i + 1; j < end; ++j)
+            {
+                const Entry& b = m_entries[m_cells[j].slot];
+                if (!(a.box.minX < b.box.maxX && a.box.maxX > b.box.minX &&
+                      a.box.minY < b.box.maxY && a.box.maxY > b.box.minY))
+                    continue;
+
+                // Boxes sharing several cells are reported only from the cell holding the
+                // top-left corner of their intersection
+                if (_cellKey(cellOf(std::max(a.box.minX, b.box.minX)),
+                             cellOf(std::max(a.box.minY, b.box.minY))) != key)
+                    continue;
+
+                pairs.push_back(std::min(a.id, b.id));
+                pairs.push_back(std::max(a.id, b.id));
+            }
+        }
+        begin = end;
+    }
+
+    const auto count = static_cast<py::ssize_t>(pairs.size() / 2);
+    py::array_t<int64_t> result({count, py::ssize_t{2}});
+    std::copy(pairs.begin(), pairs.end(), result.mutable_data());
+    return result;
+}
+
+int SpatialHash::cellOf(const double coord) const
+{
+    // Clamped so far-off coordinates cannot overflow the cell index
+    const double cell = std::floor(coord * m_invCellSize);
+    return static_cast<int>(std::clamp(cell, -1073741824.0, 1073741823.0));
+}
+
+void SpatialHash::add(const int64_t id, const Box& box)
+{
+    if (m_slots.count(id))
+        throw std::invalid_argument("A shape with id " + std::to_string(id) + " already exists");
+
+    m_slots.emplace(id, static_cast<int>(m_entries.size()));
+    m_entries.push_back({id, box, cellOf(box.minX), cellOf(box.minY), cellOf(box.maxX),
+                         cellOf(box.maxY)});
+    m_dirty = true;
+}
+
+void SpatialHash::update(const int64_t id, const Box& box)
+{
+    const auto it = m_slots.find(id);
+    if (it == m_slots.end())
+        throw py::key_error("No shape with id " + std::to_string(id));
+
+    Entry& entry = m_entries[it->second];
+    entry.box = box;
+
+    // The grid only records which cells a box covers, so moves within them need no rebuild
+    const int cellX0 = cellOf(box.minX);
+    const int cellY0 = cellOf(box.minY);
+    const int cellX1 = cellOf(box.maxX);
+    const int cellY1 = cellOf(box.maxY);
+    if (cellX0 != entry.cellX0 || cellY0 != entry.cellY0 || cellX1 != entry.cellX1 ||
+        cellY1 != entry.cellY1)
+    {
+        entry.cellX0 = cellX0;
+        entry.cellY0 = cellY0;
+        entry.cellX1 = cellX1;
+        entry.cellY1 = cellY1;
+        m_dirty = true;
+    }
+}
+
+void SpatialHash::rebuild() const
+{
+    if (!m_dirty)
+        return;
+
+    m_cells.clear();
+    for (size_t slot = 0; slot < m_entries.size(); ++slot)
+    {
+        const Entry& entry = m_entries[slot];
+        for (int cellY = entry.cellY0; cellY <= entry.cellY1; ++cellY)
+            for (int cellX = entry.cellX0; cellX <= entry.cellX1; ++cellX)
+                m_cells.push_back({_cellKey(cellX, cellY), static_cast<int>(slot)});
+    }
+
+    std::sort(m_cells.begin(), m_cells.end(), [](const CellRef& a, const CellRef& b)
+              { return a.key < b.key || (a.key == b.key && a.slot < b.slot); });
+    m_dirty = false;
+}
+
+template <typename Fn>
+void SpatialHash::forEachInBox(const Box& region, Fn&& fn) const
+{
+    const auto touches = [&region](const Box& box)
+    {
+        return box.minX <= region.maxX && box.maxX >= region.minX && box.minY <= region.maxY &&
+               box.maxY >= region.minY;
+    };
+
+    const int cellX0 = cellOf(region.minX);
+    const int cellY0 = cellOf(region.minY);
+    const int cellX1 = cellOf(region.maxX);
+    const int cellY1 = cellOf(region.maxY);
+
+    // A region covering more cells than there are shapes is cheaper to scan directly
+    const double cellCount = (static_cast<double>(cellX1) - cellX0 + 1.0) *
+                             (static_cast<double>(cellY1) - cellY0 + 1.0);
+    if (cellCount > static_cast<double>(m_entries.size()))
+    {
+        for (size_t slot = 0; slot < m_entries.size(); ++slot)
+        {
+            if (touches(m_entries[slot].box))
+                fn(static_cast<int>(slot));
+        }
+        return;
+    }
+
+    rebuild();
+
+    // Keys are ordered by row then column, so each row of cells is one contiguous run
+    for (int cellY = cellY0; cellY <= cellY1; ++cellY)
+    {
+        const uint64_t first = _cellKey(cellX0, cellY);
+        const uint64_t last = _cellKey(cellX1, cellY);
+        auto it = std::lower_bound(m_cells.begin(), m_cells.end(), first,
+                                   [](const CellRef& ref, const uint64_t key)
+                                   { return ref.key < key; });
+        for (; it != m_cells.end() && it->key <= last; ++it)
+        {
+            const Box& box = m_entries[it->slot].box;
+            if (!touches(box))
+                continue;
+
+            // Boxes spanning several cells are reported only from the cell holding the
+            // top-left corner of their overlap with the region
+            const uint64_t home = _cellKey(cellOf(std::max(box.minX, region.minX)),
+                                           cellOf(std::max(box.minY, region.minY)));
+            if (home == it->key)
+                fn(it->slot);
+        }
+    }
+}
+
+// Row-major key with the cell's row in the high half, so sorting groups cells by row and
+// orders each row by column. Offsetting by 2^31 keeps negative cells below positive ones
+uint64_t _cellKey(const int cellX, const int cellY)
+{
+    const auto biasedX = static_cast<uint64_t>(static_cast<int64_t>(cellX) + 2147483648LL);
+    const auto biasedY = static_cast<uint64_t>(static_cast<int64_t>(cellY) + 2147483648LL);
+    return (biasedY << 32) | biasedX;
+}
+
+py::array_t<int64_t> _toArray(const std::vector<int64_t>& ids)
+{
+    py::array_t<int64_t> result(static_cast<py::ssize_t>(ids.size()));
+    std::copy(ids.begin(), ids.end(), result.mutable_data());
+    return result;
+}
@@ -1,4 +1,5 @@
 #include "Texture.hpp"
+#include "Batch.hpp"
 #include "Camera.hpp"
 #include "Color.hpp"
 #include "Math.hpp"
@@ -9,6 +10,9 @@
 #include "_globals.hpp"
 
 #include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <cmath>
+#include <pybind11/stl.h>
 
 namespace texture
 {
@@ -40,11 +44,14 @@ When True, the texture is mirrored vertically (top-bottom flip).
         )doc");
 
     texture
-        .def(py::init<const std::string&>(), py::arg("file_path"), R"doc(
+        .def(py::init<const std::string&, bool>(), py::arg("file_path"),
+             py::arg("premultiplied") = false, R"doc(
 Create a Texture by loading an image from a file.
 
 Args:
     file_path (str): Path to the image file to load.
+    premultiplied (bool, optional): Whether to premultiply the color channels by alpha on
+                                    load and blend accordingly. Defaults to False.
 
 Raises:
     ValueError: If file_path is empty.
@@ -53,12 +60,29 @@ Raises:
         .def(py::init<const PixelArray&>(), py::arg("pixel_array"), R"doc(
 Create a Texture from an existing PixelArray.
 
+A premultiplied pixel array creates a texture that blends premultiplied colors.
+
 Args:
     pixel_array (PixelArray): The pixel array to convert to a texture.
 
 Raises:
     RuntimeError: If texture creation from pixel array fails.
         )doc")
+        .def(py::init<const std::vector<std::shared_ptr<PixelArray>>&>(), py::arg("mips"),
+             R"doc(
+Create a Texture from a mip chain, such as the one returned by transform.build_mips.
+
+The first level is the full-size texture. When the texture is drawn at less than half its
+size, the level closest to (and no smaller than) the drawn size is sampled instead, so
+shrunken sprites do not shimmer. All levels are filtered linearly.
+
+Args:
+    mips (list[PixelArray]): The levels from largest to smallest.
+
+Raises:
+    ValueError: If mips is empty or a level is larger than the one before it.
+    RuntimeError: If texture creation fails.
+        )doc")
 
         .def_readwrite("angle", &Texture::angle, R"doc(
 The rotation angle in degrees for rendering.
@@ -127,6 +151,16 @@ creating darkening and shadow effects.
 Set the texture to use normal (alpha) blending mode.
 
 This is the default blending mode for standard transparency effects.
+        )doc")
+        .def_property_readonly("mip_levels", &Texture::getMipLevels, R"doc(
+The number of resolution levels, including the full-size texture.
+
+Textures created from a single image or pixel array have one level.
+        )doc")
+        .def_property_readonly("premultiplied", &Texture::isPremultiplied, R"doc(
+Whether the texture's color channels are premultiplied by alpha.
+
+Normal and additive blending account for this automatically.
         )doc")
         .def("render", py::overload_cast<Rect, py::object>(&Texture::render), py::arg("dst"),
              py::arg("src") = py::none(), R"doc(
@@ -144,6 +178,28 @@ Render this texture at the specified position with anchor alignment.
 Args:
     pos (Vec2, optional): The position to draw at. Defaults to (0, 0).
     anchor (Anchor, optional): The anchor point for positioning. Defaults to CENTER.
+    )doc")
+        .def("render_many", &Texture::renderMany, py::arg("positions"),
+             py::arg("src_rects") = py::none(), py::arg("angles") = py::none(),
+             py::arg("scales") = py::none(), py::arg("tints") = py::none(), R"doc(
+Render many instances of this texture from NumPy arrays in a single submission.
+
+Each instance is centered on its position. Camera offset and off-screen culling are
+applied in C++, and all visible instances are emitted as one geometry batch.
+
+Args:
+    positions (numpy.ndarray): Array with shape (N,2) containing the center x,y of each instance.
+    src_rects (numpy.ndarray, optional): Array with shape (N,4) containing x,y,w,h source
+                                         rectangles. Defaults to the entire texture.
+    angles (numpy.ndarray, optional): Array with shape (N,) of rotation angles in degrees.
+                                      Defaults to the texture's angle.
+    scales (numpy.ndarray, optional): Array with shape (N,) of uniform scale factors. Defaults to 1.
+    tints (numpy.ndarray, optional): Array with shape (N,4) of uint8 RGBA tints, multiplied with
+                                     the texture's tint and alpha.
+
+Raises:
+    ValueError: If any array has the wrong shape or length.
+    RuntimeError: If rendering fails.
     )doc");
 }
 } // namespace texture
@@ -159,9 +215,15 @@ Texture::Texture(const PixelArray& pixelArray)
     }
 
     SDL_SetTextureScaleMode(m_texPtr, SDL_SCALEMODE_NEAREST);
+
+    if (pixelArray.isPremultiplied())
+    {
+        SDL_SetTextureBlendMode(m_texPtr, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        m_premultiplied = true;
+    }
 }
 
-Texture::Texture(const std::string& filePath)
+Texture::Texture(const std::string& filePath, const bool premultiplied)
 {
     if (filePath.empty())
         throw std::invalid_argument("File path cannot be empty");
@@ -172,22 +234,78 @@ Texture::Texture(const std::string& filePath)
         m_texPtr = nullptr;
     }
 
-    m_texPtr = IMG_LoadTexture(renderer::get(), filePath.c_str());
-    if (!m_texPtr)
-        throw std::runtime_error("Failed to load texture: " + std::string(SDL_GetError()));
+    if (premultiplied)
+    {
+        const PixelArray pixelArray(filePath, true);
+        m_texPtr = SDL_CreateTextureFromSurface(renderer::get(), pixelArray.getSDL());
+        if (!m_texPtr)
+            throw std::runtime_error("Failed to load texture: " + std::string(SDL_GetError()));
+
+        SDL_SetTextureBlendMode(m_texPtr, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        m_premultiplied = true;
+    }
+    else
+    {
+        m_texPtr = IMG_LoadTexture(renderer::get(), filePath.c_str());
+        if (!m_texPtr)
+            throw std::runtime_error("Failed to load texture: " + std::string(SDL_GetError()));
+    }
 
     SDL_SetTextureScaleMode(m_texPtr, SDL_SCALEMODE_NEAREST);
 }
 
+Texture::Texture(const std::vector<std::shared_ptr<PixelArray>>& mips)
+{
+    if (mips.empty())
+        throw std::invalid_argument("Mip chain cannot be empty");
+
+    for (size_t i = 0; i < mips.size(); ++i)
+    {
+        if (!mips[i])
+            throw std::invalid_argument("Mip levels cannot be None");
+        if (i > 0 && (mips[i]->getWidth() > mips[i - 1]->getWidth() ||
+                      mips[i]->getHeight() > mips[i - 1]->getHeight()))
+            throw std::invalid_argument("Each mip level must be no larger than the one before it");
+    }
+
+    m_premultiplied = mips.front()->isPremultiplied();
+    const SDL_BlendMode blendMode =
+        m_premultiplied ? SDL_BLENDMODE_BLEND_PREMULTIPLIED : SDL_BLENDMODE_BLEND;
+
+    for (size_t i = 0; i < mips.size(); ++i)
+    {
+        SDL_Texture* level = SDL_CreateTextureFromSurface(renderer::get(), mips[i]->getSDL());
+        if (!level)
+        {
+            const std::string error = SDL_GetError();
+            if (m_texPtr)
+                SDL_DestroyTexture(m_texPtr);
+            destroyMips();
+            throw std::runtime_error("Failed to create texture from mip level: " + error);
+        }
+
+        SDL_SetTextureScaleMode(level, SDL_SCALEMODE_LINEAR);
+        SDL_SetTextureBlendMode(level, blendMode);
+
+        if (i == 0)
+            m_texPtr = level;
+        else
+            m_mips.push_back(level);
+    }
+}
+
 Texture::Texture(SDL_Texture* sdlTexture) { this->loadFromSDL(sdlTexture); }
 
 Texture::~Texture()
 {
     if (m_texPtr)
     {
+        // Queued quads may still reference this texture
+        batch::flush();
         SDL_DestroyTexture(m_texPtr);
         m_texPtr = nullptr;
     }
+    destroyMips();
 }
 
 void Texture::loadFromSDL(SDL_Texture* sdlTexture)
@@ -197,10 +315,18 @@ void Texture::loadFromSDL(SDL_Texture* sdlTexture)
         SDL_DestroyTexture(m_texPtr);
         m_texPtr = nullptr;
     }
+    destroyMips();
 
     m_texPtr = sdlTexture;
 }
 
+void Texture::destroyMips()
+{
+    for (SDL_Texture* mip : m_mips)
+        SDL_DestroyTexture(mip);
+    m_mips.clear();
+}
+
 Vec2 Texture::getSize() const
 {
     float w, h;
@@ -218,6 +344,8 @@ Rect Texture::getRect() const
 void Texture::setTint(const Color& tint) const
 {
     SDL_SetTextureColorMod(m_texPtr, tint.r, tint.g, tint.b);
+    for (SDL_Texture* mip : m_mips)
+        SDL_SetTextureColorMod(mip, tint.r, tint.g, tint.b);
 }
 
 Color Texture::getTint() const
@@ -227,7 +355,12 @@ Color Texture::getTint() const
     return colorMod;
 }
 
-void Texture::setAlpha(float alpha) const { SDL_SetTextureAlphaModFloat(m_texPtr, alpha); }
+void Texture::setAlpha(float alpha) const
+{
+    SDL_SetTextureAlphaModFloat(m_texPtr, alpha);
+    for (SDL_Texture* mip : m_mips)
+        SDL_SetTextureAlphaModFloat(mip, alpha);
+}
 
 float Texture::getAlpha() const
 {
@@ -236,11 +369,33 @@ float Texture::getAlpha() const
     return alphaMod;
 }
 
-void Texture::makeAdditive() const { SDL_SetTextureBlendMode(m_texPtr, SDL_BLENDMODE_ADD); }
+void Texture::makeAdditive() const
+{
+    const SDL_BlendMode mode = m_premultiplied ? SDL_BLENDMODE_ADD_PREMULTIPLIED : SDL_BLENDMODE_ADD;
+    SDL_SetTextureBlendMode(m_texPtr, mode);
+    for (SDL_Texture* mip : m_mips)
+        SDL_SetTextureBlendMode(mip, mode);
+}
 
-void Texture::makeMultiply() const { SDL_SetTextureBlendMode(m_texPtr, SDL_BLENDMODE_MUL); }
+void Texture::makeMultiply() const
+{
+    SDL_SetTextureBlendMode(m_texPtr, SDL_BLENDMODE_MUL);
+    for (SDL_Texture* mip : m_mips)
+        SDL_SetTextureBlendMode(mip, SDL_BLENDMODE_MUL);
+}
 
-void Texture::makeNormal() const { SDL_SetTextureBlendMode(m_texPtr, SDL_BLENDMODE_BLEND); }
+void Texture::makeNormal() const
+{
+    const SDL_BlendMode mode =
+        m_premultiplied ? SDL_BLENDMODE_BLEND_PREMULTIPLIED : SDL_BLENDMODE_BLEND;
+    SDL_SetTextureBlendMode(m_texPtr, mode);
+    for (SDL_Texture* mip : m_mips)
+        SDL_SetTextureBlendMode(mip, mode);
+}
+
+bool Texture::isPremultiplied() const { return m_premultiplied; }
+
+int Texture::getMipLevels() const { return static_cast<int>(m_mips.size()) + 1; }
 
 SDL_Texture* Texture::getSDL() const { return m_texPtr; }
 
@@ -263,20 +418,7 @@ void Texture::render(Rect dstRect, py::object srcRect)
         srcSDLRect = this->getRect();
     }
 
-    Vec2 cameraPos = camera::getActivePos();
-
-    SDL_FlipMode flipAxis = SDL_FLIP_NONE;
-    if (this->flip.h)
-        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_HORIZONTAL);
-    if (this->flip.v)
-        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_VERTICAL);
-
-    dstRect.x -= cameraPos.x;
-    dstRect.y -= cameraPos.y;
-    SDL_FRect dstSDLRect = dstRect;
-
-    SDL_RenderTextureRotated(renderer::get(), m_texPtr, &srcSDLRect, &dstSDLRect, this->angle,
-                             nullptr, flipAxis);
+    this->_render(srcSDLRect, dstRect, this->angle, this->flip);
 }
 
 void Texture::render(py::object pos, const Anchor anchor)
@@ -294,13 +436,6 @@ void Texture::render(py::object pos, const Anchor anchor)
         }
     }
 
-    SDL_FlipMode flipAxis = SDL_FLIP_NONE;
-    if (this->flip.h)
-        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_HORIZONTAL);
-    if (this->flip.v)
-        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_VERTICAL);
-
-    drawPos -= camera::getActivePos();
     Rect rect = this->getRect();
     switch (anchor)
     {
@@ -333,7 +468,198 @@ void Texture::render(py::object pos, const Anchor anchor)
         break;
     }
 
-    const SDL_FRect dstSDLRect = rect;
-    SDL_RenderTextureRotated(renderer::get(), m_texPtr, nullptr, &dstSDLRect, this->angle, nullptr,
+    this->_render(this->getRect(), rect, this->angle, this->flip);
+}
+
+void Texture::_render(const SDL_FRect& srcRect, SDL_FRect dstRect, const double angle,
+                      const Flip& flipMode) const
+{
+    const Vec2 cameraPos = camera::getActivePos();
+    dstRect.x -= static_cast<float>(cameraPos.x);
+    dstRect.y -= static_cast<float>(cameraPos.y);
+
+    SDL_FlipMode flipAxis = SDL_FLIP_NONE;
+    if (flipMode.h)
+        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_HORIZONTAL);
+    if (flipMode.v)
+        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_VERTICAL);
+
+    SDL_FRect bounds = dstRect;
+    if (angle != 0.0)
+    {
+        const float radius = SDL_sqrtf(dstRect.w * dstRect.w + dstRect.h * dstRect.h) * 0.5f;
+        bounds = {dstRect.x + dstRect.w * 0.5f - radius, dstRect.y + dstRect.h * 0.5f - radius,
+                  radius * 2.f, radius * 2.f};
+    }
+    if (!renderer::_submit(bounds))
+        return;
+
+    // Below half size, sample the largest mip level that is still no smaller than the output
+    SDL_Texture* texture = m_texPtr;
+    SDL_FRect levelSrc = srcRect;
+    if (!m_mips.empty() && srcRect.w > 0.f && srcRect.h > 0.f)
+    {
+        const float scale =
+            std::min(std::abs(dstRect.w) / srcRect.w, std::abs(dstRect.h) / srcRect.h);
+        if (scale > 0.f && scale < 0.5f)
+        {
+            const size_t level =
+                std::min(static_cast<size_t>(std::log2(1.f / scale)), m_mips.size());
+            texture = m_mips[level - 1];
+
+            const float ratioX = static_cast<float>(texture->w) / static_cast<float>(m_texPtr->w);
+            const float ratioY = static_cast<float>(texture->h) / static_cast<float>(m_texPtr->h);
+            levelSrc = {srcRect.x * ratioX, srcRect.y * ratioY, srcRect.w * ratioX,
+                        srcRect.h * ratioY};
+        }
+    }
+
+    if (batch::isActive())
+    {
+        batch::Quad quad;
+        quad.dst = dstRect;
+        quad.src = levelSrc;
+        quad.angle = angle;
+        quad.flip = flipAxis;
+        SDL_GetTextureColorModFloat(texture, &quad.color.r, &quad.color.g, &quad.color.b);
+        SDL_GetTextureAlphaModFloat(texture, &quad.color.a);
+        batch::add(texture, quad);
+        return;
+    }
+
+    SDL_RenderTextureRotated(renderer::get(), texture, &levelSrc, &dstRect, angle, nullptr,
                              flipAxis);
 }
+
+void Texture::renderMany(py::array_t<double, py::array::c_style | py::array::forcecast> positions,
+                         py::object srcRects, py::object angles, py::object scales,
+                         py::object tints)
+{
+    using DoubleArray = py::array_t<double, py::array::c_style | py::array::forcecast>;
+    using ByteArray = py::array_t<uint8_t, py::array::c_style | py::array::forcecast>;
+
+    auto posInfo = positions.request();
+    if (posInfo.ndim != 2 || posInfo.shape[1] != 2)
+        throw std::invalid_argument("Expected 'positions' array shape (N,2)");
+
+    const auto n = static_cast<size_t>(posInfo.shape[0]);
+    if (n == 0)
+        return;
+
+    const double* posData = static_cast<double*>(posInfo.ptr);
+
+    auto optionalArray = [n](const py::object& obj, const char* name, const py::ssize_t cols,
+                             auto tag) -> decltype(tag)
+    {
+        using ArrayT = decltype(tag);
+        if (obj.is_none())
+            return ArrayT();
+
+        ArrayT arr;
+        try
+        {
+            arr = obj.cast<ArrayT>();
+        }
+        catch (const py::cast_error&)
+        {
+            throw std::invalid_argument(std::string("'") + name + "' must be a NumPy array");
+        }
+
+        const bool shapeOk = cols == 0 ? arr.ndim() == 1 : arr.ndim() == 2 && arr.shape(1) == cols;
+        if (!shapeOk || static_cast<size_t>(arr.shape(0)) != n)
+            throw std::invalid_argument(std::string("'") + name +
+                                        "' array does not match the shape of 'positions'");
+        return arr;
+    };
+
+    const DoubleArray srcArr = optionalArray(srcRects, "src_rects", 4, DoubleArray());
+    const DoubleArray angleArr = optionalArray(angles, "angles", 0, DoubleArray());
+    const DoubleArray scaleArr = optionalArray(scales, "scales", 0, DoubleArray());
+    const ByteArray tintArr = optionalArray(tints, "tints", 4, ByteArray());
+
+    const double* srcData = srcRects.is_none() ? nullptr : srcArr.data();
+    const double* angleData = angles.is_none() ? nullptr : angleArr.data();
+    const double* scaleData = scales.is_none() ? nullptr : scaleArr.data();
+    const uint8_t* tintData = tints.is_none() ? nullptr : tintArr.data();
+
+    SDL_FColor baseColor;
+    SDL_GetTextureColorModFloat(m_texPtr, &baseColor.r, &baseColor.g, &baseColor.b);
+    SDL_GetTextureAlphaModFloat(m_texPtr, &baseColor.a);
+
+    SDL_FlipMode flipAxis = SDL_FLIP_NONE;
+    if (this->flip.h)
+        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_HORIZONTAL);
+    if (this->flip.v)
+        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_VERTICAL);
+
+    const auto texW = static_cast<float>(m_texPtr->w);
+    const auto texH = static_cast<float>(m_texPtr->h);
+    const Vec2 cameraPos = camera::getActivePos();
+    const bool batching = batch::isActive();
+
+    static std::vector<SDL_Vertex> vertices;
+    static std::vector<int> indices;
+    vertices.clear();
+    indices.clear();
+    if (!batching)
+    {
+        vertices.reserve(n * 4);
+        indices.reserve(n * 6);
+    }
+
+    batch::Quad quad;
+    quad.flip = flipAxis;
+    quad.color = baseColor;
+    quad.src = {0.f, 0.f, texW, texH};
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (srcData)
+        {
+            const double* src = srcData + i * 4;
+            quad.src = {static_cast<float>(src[0]), static_cast<float>(src[1]),
+                        static_cast<float>(src[2]), static_cast<float>(src[3])};
+        }
+
+        const double scale = scaleData ? scaleData[i] : 1.0;
+        quad.angle = angleData ? angleData[i] : this->angle;
+
+        const double w = quad.src.w * scale;
+        const double h = quad.src.h * scale;
+        const double cx = posData[i * 2 + 0] - cameraPos.x;
+        const double cy = posData[i * 2 + 1] - cameraPos.y;
+
+        // Cull against the viewport using the rotated bounding radius when needed
+        double extX = std::abs(w) * 0.5;
+        double extY = std::abs(h) * 0.5;
+        if (quad.angle != 0.0)
+            extX = extY = std::sqrt(extX * extX + extY * extY);
+        if (!renderer::_submit({static_cast<float>(cx - extX), static_cast<float>(cy - extY),
+                                static_cast<float>(extX * 2.0), static_cast<float>(extY * 2.0)}))
+            continue;
+
+        quad.dst = {static_cast<float>(cx - w * 0.5), static_cast<float>(cy - h * 0.5),
+                    static_cast<float>(w), static_cast<float>(h)};
+
+        if (tintData)
+        {
+            const uint8_t* tint = tintData + i * 4;
+            quad.color = {baseColor.r * tint[0] / 255.f, baseColor.g * tint[1] / 255.f,
+                          baseColor.b * tint[2] / 255.f, baseColor.a * tint[3] / 255.f};
+        }
+
+        if (batching)
+            batch::add(m_texPtr, quad);
+        else
+            batch::appendQuad(vertices, indices, quad, texW, texH);
+    }
+
+    if (batching || indices.empty())
+        return;
+
+    if (!SDL_RenderGeometry(renderer::get(), m_texPtr, vertices.data(),
+                            static_cast<int>(vertices.size()), indices.data(),
+                            static_cast<int>(indices.size())))
+        throw std::runtime_error("Failed to render texture instances: " +
+                                 std::string(SDL_GetError()));
+}
@@ -0,0 +1,514 @@
+#include "TextureAtlas.hpp"
+#include "Math.hpp"
+#include "PixelArray.hpp"
+#include "Rect.hpp"
+#include "_globals.hpp"
+
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <limits>
+#include <pybind11/stl.h>
+#include <stdexcept>
+
+namespace
+{
+// Bottom-left skyline packer for a single atlas page
+class Skyline
+{
+  public:
+    explicit Skyline(const int size) : m_size(size) { m_nodes.push_back({0, 0, size}); }
+
+    bool insert(const int w, const int h, SDL_Rect& out)
+    {
+        int bestY = std::numeric_limits<int>::max();
+        int bestWidth = std::numeric_limits<int>::max();
+        int bestIndex = -1;
+
+        for (size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            int y;
+            if (!fits(i, w, h, y))
+                continue;
+
+            if (y + h < bestY || (y + h == bestY && m_nodes[i].width < bestWidth))
+            {
+                bestY = y + h;
+                bestWidth = m_nodes[i].width;
+                bestIndex = static_cast<int>(i);
+                out = {m_nodes[i].x, y, w, h};
+            }
+        }
+
+        if (bestIndex < 0)
+            return false;
+
+        addLevel(static_cast<size_t>(bestIndex), out);
+        m_usedHeight = std::max(m_usedHeight, out.y + out.h);
+        return true;
+    }
+
+    int getUsedHeight() const { return m_usedHeight; }
+
+  private:
+    struct Node
+    {
+        int x, y, width;
+    };
+
+    int m_size;
+    int m_usedHeight = 0;
+    std::vector<Node> m_nodes;
+
+    bool fits(const size_t index, const int w, const int h, int& y) const
+    {
+        if (m_nodes[index].x + w > m_size)
+            return false;
+
+        y = m_nodes[index].y;
+        int remaining = w;
+        for (size_t i = index; remaining > 0; ++i)
+        {
+            if (i >= m_nodes.size())
+                return false;
+            y = std::max(y, m_nodes[i].y);
+            if (y + h > m_size)
+                return false;
+            remaining -= m_nodes[i].width;
+        }
+        return true;
+    }
+
+    void addLevel(const size_t index, const SDL_Rect& rect)
+    {
+        m_nodes.insert(m_nodes.begin() + static_cast<std::ptrdiff_t>(index),
+                       {rect.x, rect.y + rect.h, rect.w});
+
+        // Shrink or remove the nodes now covered by the new one
+        for (size_t i = index + 1; i < m_nodes.size();)
+        {
+            const Node& prev = m_nodes[i - 1];
+            Node& node = m_nodes[i];
+            if (node.x >= prev.x + prev.width)
+                break;
+
+            const int shrink = prev.x + prev.width - node.x;
+            node.x += shrink;
+            node.width -= shrink;
+            if (node.width > 0)
+                break;
+            m_nodes.erase(m_nodes.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+
+        // Merge neighbouring nodes at the same height
+        for (size_t i = 0; i + 1 < m_nodes.size();)
+        {
+            if (m_nodes[i].y == m_nodes[i + 1].y)
+            {
+                m_nodes[i].width += m_nodes[i + 1].width;
+                m_nodes.erase(m_nodes.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            }
+            else
+                ++i;
+        }
+    }
+};
+} // namespace
+
+namespace texture_atlas
+{
+void _bind(py::module_& module)
+{
+    py::classh<AtlasRegion>(module, "AtlasRegion", R"doc(
+A lightweight handle to a sub-image packed into a TextureAtlas page.
+
+Regions render like a Texture but share their page texture with every other region on
+the same page, so consecutive region draws can be batched together. Tint, alpha and
+blend mode are properties of the shared page texture.
+    )doc")
+        .def_readwrite("angle", &AtlasRegion::angle, R"doc(
+The rotation angle in degrees for rendering.
+        )doc")
+        .def_readwrite("flip", &AtlasRegion::flip, R"doc(
+The flip settings for horizontal and vertical mirroring.
+        )doc")
+        .def_property_readonly("texture", &AtlasRegion::getTexture, R"doc(
+The atlas page texture this region lives on.
+        )doc")
+        .def_property_readonly("src_rect", &AtlasRegion::getSrcRect, R"doc(
+The region's rectangle within its atlas page.
+        )doc")
+
+        .def("get_size", &AtlasRegion::getSize, R"doc(
+Get the size of the region.
+
+Returns:
+    Vec2: The region size as (width, height).
+        )doc")
+        .def("get_rect", &AtlasRegion::getRect, R"doc(
+Get a rectangle representing the region bounds.
+
+Returns:
+    Rect: A rectangle with position (0, 0) and the region's dimensions.
+        )doc")
+        .def("render", py::overload_cast<Rect, py::object>(&AtlasRegion::render, py::const_),
+             py::arg("dst"), py::arg("src") = py::none(), R"doc(
+Render this region with specified destination and source rectangles.
+
+Args:
+    dst (Rect): The destination rectangle on the renderer.
+    src (Rect, optional): The source rectangle, relative to the region. Defaults to the entire region.
+        )doc")
+        .def("render", py::overload_cast<py::object, Anchor>(&AtlasRegion::render, py::const_),
+             py::arg("pos") = py::none(), py::arg("anchor") = Anchor::CENTER, R"doc(
+Render this region at the specified position with anchor alignment.
+
+Args:
+    pos (Vec2, optional): The position to draw at. Defaults to (0, 0).
+    anchor (Anchor, optional): The anchor point for positioning. Defaults to CENTER.
+        )doc");
+
+    py::classh<TextureAtlas>(module, "TextureAtlas", R"doc(
+Packs many images into a few large textures to minimize texture switches.
+
+Images are queued with add() and packed with build(), which uses a skyline packer to
+place them onto one or more square pages. Each packed image is then available as an
+AtlasRegion by name.
+
+All pages share one alpha layout, chosen when the atlas is created. Straight alpha images
+added to a premultiplied atlas are premultiplied as they are queued.
+    )doc")
+        .def(py::init<int, int, bool>(), py::arg("page_size") = 2048, py::arg("padding") = 1,
+             py::kw_only(), py::arg("premultiplied") = false, R"doc(
+Create an empty texture atlas.
+
+Args:
+    page_size (int, optional): The width and height of each atlas page. Defaults to 2048.
+    padding (int, optional): Transparent pixels kept between packed images. Defaults to 1.
+    premultiplied (bool, optional): Whether the pages store premultiplied colors and blend
+                                    accordingly. Defaults to False.
+
+Raises:
+    ValueError: If page_size is not positive or padding is negative.
+        )doc")
+        .def("add",
+             py::overload_cast<const std::string&, const PixelArray&>(&TextureAtlas::add),
+             py::arg("name"), py::arg("pixel_array"), R"doc(
+Queue a pixel array to be packed into the atlas.
+
+Args:
+    name (str): The name used to look up the region after building.
+    pixel_array (PixelArray): The image to pack. Its pixels are copied.
+
+Raises:
+    ValueError: If the name is already used, the image is larger than a page, or the image
+                is premultiplied and the atlas is not.
+        )doc")
+        .def("add",
+             py::overload_cast<const std::string&, const std::string&>(&TextureAtlas::add),
+             py::arg("name"), py::arg("file_path"), R"doc(
+Queue an image file to be packed into the atlas.
+
+Args:
+    name (str): The name used to look up the region after building.
+    file_path (str): Path to the image file to load.
+
+Raises:
+    ValueError: If the name is already used or the image is larger than a page.
+    RuntimeError: If the file cannot be loaded.
+        )doc")
+        .def("build", &TextureAtlas::build, R"doc(
+Pack all queued images onto new atlas pages and create their regions.
+
+Images queued after a build are packed onto fresh pages by the next build.
+
+Raises:
+    RuntimeError: If page texture creation fails.
+        )doc")
+        .def("get", &TextureAtlas::get, py::arg("name"), R"doc(
+Get a packed region by name.
+
+Args:
+    name (str): The name the image was added with.
+
+Returns:
+    AtlasRegion: The packed region.
+
+Raises:
+    KeyError: If no built region has that name.
+        )doc")
+        .def("__getitem__", &TextureAtlas::get, py::arg("name"))
+        .def("__contains__", &TextureAtlas::contains, py::arg("name"))
+        .def("__len__", &TextureAtlas::getCount)
+        .def_property_readonly("pages", &TextureAtlas::getPages, R"doc(
+The list of atlas page textures.
+        )doc")
+        .def_property_readonly("premultiplied", &TextureAtlas::isPremultiplied, R"doc(
+Whether the atlas pages store premultiplied colors.
+        )doc");
+}
+} // namespace texture_atlas
+
+AtlasRegion::AtlasRegion(std::shared_ptr<Texture> page, const SDL_FRect& srcRect)
+    : m_page(std::move(page)), m_srcRect(srcRect)
+{
+}
+
+Vec2 AtlasRegion::getSize() const { return {m_srcRect.w, m_srcRect.h}; }
+
+Rect AtlasRegion::getRect() const { return {0.f, 0.f, m_srcRect.w, m_srcRect.h}; }
+
+Rect AtlasRegion::getSrcRect() const
+{
+    return {m_srcRect.x, m_srcRect.y, m_srcRect.w, m_srcRect.h};
+}
+
+std::shared_ptr<Texture> AtlasRegion::getTexture() const { return m_page; }
+
+void AtlasRegion::render(Rect dstRect, py::object srcRect) const
+{
+    SDL_FRect srcSDLRect = m_srcRect;
+    if (!srcRect.is_none())
+    {
+        Rect local;
+        try
+        {
+            local = srcRect.cast<Rect>();
+        }
+        catch (const py::cast_error&)
+        {
+            throw std::invalid_argument("'src' must be a Rect");
+        }
+        srcSDLRect.x += static_cast<float>(local.x);
+        srcSDLRect.y += static_cast<float>(local.y);
+        srcSDLRect.w = static_cast<float>(local.w);
+        srcSDLRect.h = static_cast<float>(local.h);
+    }
+
+    m_page->_render(srcSDLRect, dstRect, this->angle, this->flip);
+}
+
+void AtlasRegion::render(py::object pos, const Anchor anchor) const
+{
+    Vec2 drawPos;
+    if (!pos.is_none())
+    {
+        try
+        {
+            drawPos = pos.cast<Vec2>();
+        }
+        catch (const py::cast_error&)
+        {
+            throw std::invalid_argument("'pos' must be a Vec2");
+        }
+    }
+
+    Rect rect = this->getRect();
+    switch (anchor)
+    {
+    case Anchor::TOP_LEFT:
+        rect.setTopLeft(drawPos);
+        break;
+    case Anchor::TOP_MID:
+        rect.setTopMid(drawPos);
+        break;
+    case Anchor::TOP_RIGHT:
+        rect.setTopRight(drawPos);
+        break;
+    case Anchor::MID_LEFT:
+        rect.setMidLeft(drawPos);
+        break;
+    case Anchor::CENTER:
+        rect.setCenter(drawPos);
+        break;
+    case Anchor::MID_RIGHT:
+        rect.setMidRight(drawPos);
+        break;
+    case Anchor::BOTTOM_LEFT:
+        rect.setBottomLeft(drawPos);
+        break;
+    case Anchor::BOTTOM_MID:
+        rect.setBottomMid(drawPos);
+        break;
+    case Anchor::BOTTOM_RIGHT:
+        rect.setBottomRight(drawPos);
+        break;
+    }
+
+    m_page->_render(m_srcRect, rect, this->angle, this->flip);
+}
+
+TextureAtlas::TextureAtlas(const int pageSize, const int padding, const bool premultiplied)
+    : m_pageSize(pageSize), m_padding(padding), m_premultiplied(premultiplied)
+{
+    if (pageSize <= 0)
+        throw std::invalid_argument("Atlas page size must be positive");
+    if (padding < 0)
+        throw std::invalid_argument("Atlas padding cannot be negative");
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    for (Pending& entry : m_pending)
+        SDL_DestroySurface(entry.surface);
+}
+
+void TextureAtlas::add(const std::string& name, const PixelArray& pixelArray)
+{
+    if (pixelArray.isPremultiplied() && !m_premultiplied)
+        throw std::invalid_argument("Cannot add premultiplied image '" + name +
+                                    "' to a straight alpha atlas");
+
+    SDL_Surface* converted = pixel_array::_convertRGBA32(pixelArray.getSDL());
+    if (m_premultiplied && !pixelArray.isPremultiplied())
+        pixel_array::_premultiply(converted);
+    queue(name, converted);
+}
+
+void TextureAtlas::add(const std::string& name, const std::string& filePath)
+{
+    SDL_Surface* loaded = IMG_Load(filePath.c_str());
+    if (!loaded)
+        throw std::runtime_error("Failed to load atlas image '" + filePath +
+                                 "': " + std::string(SDL_GetError()));
+
+    SDL_Surface* converted = nullptr;
+    try
+    {
+        converted = pixel_array::_convertRGBA32(loaded);
+    }
+    catch (...)
+    {
+        SDL_DestroySurface(loaded);
+        throw;
+    }
+    SDL_DestroySurface(loaded);
+
+    if (m_premultiplied)
+        pixel_array::_premultiply(converted);
+    queue(name, converted);
+}
+
+void TextureAtlas::queue(const std::string& name, SDL_Surface* surface)
+{
+    const bool pendingName = std::any_of(m_pending.begin(), m_pending.end(),
+                                         [&](const Pending& entry) { return entry.name == name; });
+    if (pendingName || m_regions.count(name))
+    {
+        SDL_DestroySurface(surface);
+        throw std::invalid_argument("Atlas already contains an image named '" + name + "'");
+    }
+
+    if (surface->w + m_padding > m_pageSize || surface->h + m_padding > m_pageSize)
+    {
+        SDL_DestroySurface(surface);
+        throw std::invalid_argument("Image '" + name + "' does not fit in an atlas page");
+    }
+
+    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+    m_pending.push_back({name, surface});
+}
+
+void TextureAtlas::build()
+{
+    if (m_pending.empty())
+        return;
+
+    // Tallest first gives the skyline packer its tightest results
+    std::vector<Pending> entries = std::move(m_pending);
+    m_pending.clear();
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const Pending& a, const Pending& b)
+                     {
+                         if (a.surface->h != b.surface->h)
+                             return a.surface->h > b.surface->h;
+                         return a.surface->w > b.surface->w;
+                     });
+
+    struct Placement
+    {
+        size_t entry;
+        SDL_Rect rect;
+    };
+
+    std::vector<Skyline> skylines;
+    std::vector<std::vector<Placement>> pagePlacements;
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        const int w = entries[i].surface->w + m_padding;
+        const int h = entries[i].surface->h + m_padding;
+
+        SDL_Rect rect;
+        bool placed = false;
+        for (size_t page = 0; page < skylines.size() && !placed; ++page)
+            if (skylines[page].insert(w, h, rect))
+            {
+                pagePlacements[page].push_back({i, rect});
+                placed = true;
+            }
+
+        if (!placed)
+        {
+            skylines.emplace_back(m_pageSize);
+            pagePlacements.emplace_back();
+            skylines.back().insert(w, h, rect);
+            pagePlacements.back().push_back({i, rect});
+        }
+    }
+
+    try
+    {
+        for (size_t page = 0; page < skylines.size(); ++page)
+        {
+            PixelArray pagePixels(Vec2(m_pageSize, skylines[page].getUsedHeight()));
+            pagePixels.setPremultiplied(m_premultiplied);
+
+            for (const Placement& placement : pagePlacements[page])
+            {
+                SDL_Rect dst = {placement.rect.x, placement.rect.y, placement.rect.w - m_padding,
+                                placement.rect.h - m_padding};
+                if (!SDL_BlitSurface(entries[placement.entry].surface, nullptr,
+                                     pagePixels.getSDL(), &dst))
+                    throw std::runtime_error("Failed to blit image into atlas page: " +
+                                             std::string(SDL_GetError()));
+            }
+
+            auto pageTexture = std::make_shared<Texture>(pagePixels);
+            m_pages.push_back(pageTexture);
+
+            for (const Placement& placement : pagePlacements[page])
+            {
+                const SDL_FRect src = {static_cast<float>(placement.rect.x),
+                                       static_cast<float>(placement.rect.y),
+                                       static_cast<float>(placement.rect.w - m_padding),
+                                       static_cast<float>(placement.rect.h - m_padding)};
+                m_regions[entries[placement.entry].name] =
+                    std::make_shared<AtlasRegion>(pageTexture, src);
+            }
+        }
+    }
+    catch (...)
+    {
+        for (Pending& entry : entries)
+            SDL_DestroySurface(entry.surface);
+        throw;
+    }
+
+    for (Pending& entry : entries)
+        SDL_DestroySurface(entry.surface);
+}
+
+std::shared_ptr<AtlasRegion> TextureAtlas::get(const std::string& name) const
+{
+    const auto it = m_regions.find(name);
+    if (it == m_regions.end())
+        throw py::key_error("No atlas region named '" + name + "'");
+    return it->second;
+}
+
+bool TextureAtlas::contains(const std::string& name) const { return m_regions.count(name) > 0; }
+
+size_t TextureAtlas::getCount() const { return m_regions.size(); }
+
+const std::vector<std::shared_ptr<Texture>>& TextureAtlas::getPages() const { return m_pages; }
+
+bool TextureAtlas::isPremultiplied() const { return m_premultiplied; }
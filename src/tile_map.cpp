@@ -0,0 +1,321 @@
+#include "TileMap.hpp"
+#include "Batch.hpp"
+#include "Camera.hpp"
+#include "Renderer.hpp"
+#include "Texture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace tile_map
+{
+void _bind(py::module_& module)
+{
+    py::classh<TileMap>(module, "TileMap", R"doc(
+A grid of tiles drawn from a tileset texture with cached chunk geometry.
+
+The map is split into square chunks whose vertex data is built once and only rebuilt
+when one of their tiles changes. Rendering draws just the chunks that intersect the
+active camera's view, in a single geometry submission.
+
+Tile ids index the tileset left-to-right, top-to-bottom. Negative ids are empty.
+    )doc")
+        .def(py::init<std::shared_ptr<Texture>, const Vec2&,
+                      py::array_t<int32_t, py::array::c_style | py::array::forcecast>, int>(),
+             py::arg("tileset"), py::arg("tile_size"), py::arg("tiles"),
+             py::arg("chunk_size") = 16, R"doc(
+Create a tile map.
+
+Args:
+    tileset (Texture): The texture containing the tile images laid out in a grid.
+    tile_size (Vec2): The size of a single tile in pixels as (width, height).
+    tiles (numpy.ndarray): Array with shape (rows, cols) of integer tile ids.
+    chunk_size (int, optional): The width and height of a chunk in tiles. Defaults to 16.
+
+Raises:
+    ValueError: If the tile size, chunk size or tiles array shape is invalid.
+        )doc")
+
+        .def_readwrite("pos", &TileMap::pos, R"doc(
+The world position of the map's top-left corner.
+        )doc")
+        .def_property("tileset", &TileMap::getTileset, &TileMap::setTileset, R"doc(
+The tileset texture. Assigning a new tileset rebuilds all chunks.
+        )doc")
+        .def_property_readonly("cols", &TileMap::getCols, R"doc(
+The number of tile columns in the map.
+        )doc")
+        .def_property_readonly("rows", &TileMap::getRows, R"doc(
+The number of tile rows in the map.
+        )doc")
+        .def_property_readonly("tile_size", &TileMap::getTileSize, R"doc(
+The size of a single tile in pixels.
+        )doc")
+        .def_property_readonly("tiles", &TileMap::getTiles, R"doc(
+A read-only (rows, cols) view of the tile ids. Use set_tile or set_tiles to modify.
+
+The view follows set_tile changes. After set_tiles it keeps showing the previous ids,
+so read this property again to see the new ones.
+        )doc")
+
+        .def("get_tile", &TileMap::getTile, py::arg("col"), py::arg("row"), R"doc(
+Get the tile id at a grid cell.
+
+Args:
+    col (int): The tile column.
+    row (int): The tile row.
+
+Returns:
+    int: The tile id.
+
+Raises:
+    IndexError: If the cell is outside the map.
+        )doc")
+        .def("set_tile", &TileMap::setTile, py::arg("col"), py::arg("row"), py::arg("tile_id"),
+             R"doc(
+Set the tile id at a grid cell and mark its chunk for rebuilding.
+
+Args:
+    col (int): The tile column.
+    row (int): The tile row.
+    tile_id (int): The new tile id. Negative ids are empty.
+
+Raises:
+    IndexError: If the cell is outside the map.
+        )doc")
+        .def("set_tiles", &TileMap::setTiles, py::arg("tiles"), R"doc(
+Replace the tile ids. Only chunks containing changed tiles are rebuilt.
+
+Args:
+    tiles (numpy.ndarray): Array with shape (rows, cols) of integer tile ids.
+
+Raises:
+    ValueError: If the array is not 2-dimensional.
+        )doc")
+        .def("render", &TileMap::render, R"doc(
+Render the chunks of the map that are visible through the active camera.
+
+Raises:
+    RuntimeError: If rendering fails.
+        )doc");
+}
+} // namespace tile_map
+
+TileMap::TileMap(std::shared_ptr<Texture> tileset, const Vec2& tileSize,
+                 py::array_t<int32_t, py::array::c_style | py::array::forcecast> tiles,
+                 const int chunkSize)
+    : m_tileset(std::move(tileset)), m_tileW(static_cast<float>(tileSize.x)),
+      m_tileH(static_cast<float>(tileSize.y)), m_chunkSize(chunkSize)
+{
+    if (!m_tileset)
+        throw std::invalid_argument("Tileset texture cannot be None");
+    if (m_tileW <= 0.f || m_tileH <= 0.f)
+        throw std::invalid_argument("Tile size must be positive");
+    if (chunkSize <= 0)
+        throw std::invalid_argument("Chunk size must be positive");
+
+    setTiles(std::move(tiles));
+}
+
+int TileMap::getTile(const int col, const int row) const
+{
+    if (col < 0 || col >= m_cols || row < 0 || row >= m_rows)
+        throw std::out_of_range("Tile coordinates out of bounds for tile map");
+
+    return m_tiles.data()[static_cast<size_t>(row) * m_cols + col];
+}
+
+void TileMap::setTile(const int col, const int row, const int tileId)
+{
+    if (col < 0 || col >= m_cols || row < 0 || row >= m_rows)
+        throw std::out_of_range("Tile coordinates out of bounds for tile map");
+
+    int32_t& tile = m_tiles.mutable_data()[static_cast<size_t>(row) * m_cols + col];
+    if (tile == tileId)
+        return;
+
+    tile = tileId;
+    m_chunks[(row / m_chunkSize) * m_chunkCols + col / m_chunkSize].dirty = true;
+}
+
+void TileMap::setTiles(py::array_t<int32_t, py::array::c_style | py::array::forcecast> tiles)
+{
+    auto info = tiles.request();
+    if (info.ndim != 2)
+        throw std::invalid_argument("Expected tiles array shape (rows, cols)");
+
+    const auto rows = static_cast<int>(info.shape[0]);
+    const auto cols = static_cast<int>(info.shape[1]);
+    const auto* data = static_cast<const int32_t*>(info.ptr);
+
+    // Copy into a new array rather than overwriting the old one, which views may still hold
+    py::array_t<int32_t> newTiles({rows, cols});
+    std::copy(data, data + static_cast<size_t>(rows) * cols, newTiles.mutable_data());
+
+    if (rows != m_rows || cols != m_cols)
+    {
+        m_rows = rows;
+        m_cols = cols;
+        m_tiles = std::move(newTiles);
+        m_chunkCols = (cols + m_chunkSize - 1) / m_chunkSize;
+        m_chunkRows = (rows + m_chunkSize - 1) / m_chunkSize;
+        m_chunks.assign(static_cast<size_t>(m_chunkCols) * m_chunkRows, Chunk());
+        return;
+    }
+
+    // Same shape: only invalidate the chunks whose tiles actually changed
+    const int32_t* oldData = m_tiles.data();
+    for (int row = 0; row < rows; ++row)
+        for (int col = 0; col < cols; ++col)
+        {
+            const size_t i = static_cast<size_t>(row) * cols + col;
+            if (oldData[i] != data[i])
+                m_chunks[(row / m_chunkSize) * m_chunkCols + col / m_chunkSize].dirty = true;
+        }
+    m_tiles = std::move(newTiles);
+}
+
+py::array_t<int32_t> TileMap::getTiles() const
+{
+    py::array_t<int32_t> view({m_rows, m_cols}, m_tiles.data(), m_tiles);
+    view.attr("setflags")(py::arg("write") = false);
+    return view;
+}
+
+int TileMap::getCols() const { return m_cols; }
+
+int TileMap::getRows() const { return m_rows; }
+
+Vec2 TileMap::getTileSize() const { return {m_tileW, m_tileH}; }
+
+std::shared_ptr<Texture> TileMap::getTileset() const { return m_tileset; }
+
+void TileMap::setTileset(std::shared_ptr<Texture> tileset)
+{
+    if (!tileset)
+        throw std::invalid_argument("Tileset texture cannot be None");
+
+    m_tileset = std::move(tileset);
+    markAllDirty();
+}
+
+void TileMap::markAllDirty()
+{
+    for (Chunk& chunk : m_chunks)
+        chunk.dirty = true;
+}
+
+void TileMap::buildChunk(const int chunkCol, const int chunkRow)
+{
+    Chunk& chunk = m_chunks[static_cast<size_t>(chunkRow) * m_chunkCols + chunkCol];
+    chunk.vertices.clear();
+    chunk.dirty = false;
+
+    SDL_Texture* sdlTexture = m_tileset->getSDL();
+    const auto texW = static_cast<float>(sdlTexture->w);
+    const auto texH = static_cast<float>(sdlTexture->h);
+    const int setCols = static_cast<int>(texW / m_tileW);
+    const int setRows = static_cast<int>(texH / m_tileH);
+    const int tileCount = setCols * setRows;
+    if (tileCount <= 0)
+        return;
+
+    const int32_t* tiles = m_tiles.data();
+    const int col0 = chunkCol * m_chunkSize;
+    const int row0 = chunkRow * m_chunkSize;
+    const int col1 = std::min(col0 + m_chunkSize, m_cols);
+    const int row1 = std::min(row0 + m_chunkSize, m_rows);
+
+    for (int row = row0; row < row1; ++row)
+        for (int col = col0; col < col1; ++col)
+        {
+            const int32_t id = tiles[static_cast<size_t>(row) * m_cols + col];
+            if (id < 0 || id >= tileCount)
+                continue;
+
+            const float x0 = col * m_tileW;
+            const float y0 = row * m_tileH;
+            const float x1 = x0 + m_tileW;
+            const float y1 = y0 + m_tileH;
+            const float u0 = (id % setCols) * m_tileW / texW;
+            const float v0 = (id / setCols) * m_tileH / texH;
+            const float u1 = u0 + m_tileW / texW;
+            const float v1 = v0 + m_tileH / texH;
+
+            chunk.vertices.push_back({{x0, y0}, {1.f, 1.f, 1.f, 1.f}, {u0, v0}});
+            chunk.vertices.push_back({{x1, y0}, {1.f, 1.f, 1.f, 1.f}, {u1, v0}});
+            chunk.vertices.push_back({{x1, y1}, {1.f, 1.f, 1.f, 1.f}, {u1, v1}});
+            chunk.vertices.push_back({{x0, y1}, {1.f, 1.f, 1.f, 1.f}, {u0, v1}});
+        }
+}
+
+void TileMap::render()
+{
+    if (m_chunks.empty())
+        return;
+
+    batch::flush();
+
+    const Vec2 origin = pos - camera::getActivePos();
+    const Vec2 res = renderer::_viewSize();
+
+    // Visible tile range in map space, widened to whole chunks
+    const double chunkW = static_cast<double>(m_tileW) * m_chunkSize;
+    const double chunkH = static_cast<double>(m_tileH) * m_chunkSize;
+    const int cc0 = std::max(0, static_cast<int>(std::floor(-origin.x / chunkW)));
+    const int cr0 = std::max(0, static_cast<int>(std::floor(-origin.y / chunkH)));
+    const int cc1 =
+        std::min(m_chunkCols - 1, static_cast<int>(std::floor((res.x - origin.x) / chunkW)));
+    const int cr1 =
+        std::min(m_chunkRows - 1, static_cast<int>(std::floor((res.y - origin.y) / chunkH)));
+    if (cc0 > cc1 || cr0 > cr1)
+        return;
+
+    const SDL_FRect bounds = {static_cast<float>(origin.x + cc0 * chunkW),
+                              static_cast<float>(origin.y + cr0 * chunkH),
+                              static_cast<float>((cc1 - cc0 + 1) * chunkW),
+                              static_cast<float>((cr1 - cr0 + 1) * chunkH)};
+    if (!renderer::_submit(bounds))
+        return;
+
+    SDL_FColor color;
+    SDL_Texture* sdlTexture = m_tileset->getSDL();
+    SDL_GetTextureColorModFloat(sdlTexture, &color.r, &color.g, &color.b);
+    SDL_GetTextureAlphaModFloat(sdlTexture, &color.a);
+
+    static std::vector<SDL_Vertex> vertices;
+    static std::vector<int> indices;
+    vertices.clear();
+
+    const auto offsetX = static_cast<float>(origin.x);
+    const auto offsetY = static_cast<float>(origin.y);
+    for (int cr = cr0; cr <= cr1; ++cr)
+        for (int cc = cc0; cc <= cc1; ++cc)
+        {
+            Chunk& chunk = m_chunks[static_cast<size_t>(cr) * m_chunkCols + cc];
+            if (chunk.dirty)
+                buildChunk(cc, cr);
+
+            for (const SDL_Vertex& vertex : chunk.vertices)
+                vertices.push_back({{vertex.position.x + offsetX, vertex.position.y + offsetY},
+                                    color, vertex.tex_coord});
+        }
+
+    if (vertices.empty())
+        return;
+
+    // Every tile is a quad, so the index pattern only ever needs to grow
+    const size_t quadCount = vertices.size() / 4;
+    for (size_t q = indices.size() / 6; q < quadCount; ++q)
+    {
+        const auto base = static_cast<int>(q * 4);
+        indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+
+    if (!SDL_RenderGeometry(renderer::get(), sdlTexture, vertices.data(),
+                            static_cast<int>(vertices.size()), indices.data(),
+                            static_cast<int>(quadCount * 6)))
+        throw std::runtime_error("Failed to render tile map: " + std::string(SDL_GetError()));
+}
@@ -2,8 +2,47 @@
 #include "Color.hpp"
 #include "Math.hpp"
 #include "PixelArray.hpp"
-
-#include <gfx/SDL3_rotozoom.h>
+#include "_parallel.hpp"
+#include "_simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.1415926535897932384626433832795
+#endif
+
+// Recycled surfaces for transform outputs and temporaries, least recently released first
+static std::vector<SDL_Surface*> _surfacePool;
+static constexpr size_t MAX_POOLED_SURFACES = 8;
+
+static SDL_Surface* _acquireSurface(int w, int h);
+static void _releaseSurface(SDL_Surface* surface);
+static SDL_Surface* _toRGBA32(SDL_Surface* surface);
+static PixelArray* _resolveTarget(const PixelArray& pixelArray, const py::object& dst,
+                                  bool inplace);
+static py::object _deliver(const PixelArray& pixelArray, const py::object& dst, bool inplace,
+                           PixelArray* target, SDL_Surface* result);
+template <typename Kernel>
+static py::object _transform(const PixelArray& pixelArray, const py::object& dst, bool inplace,
+                             int w, int h, bool aliasSafe, Kernel&& kernel);
+static void _boxBlur(SDL_Surface* in, SDL_Surface* out, int radius, bool repeatEdgePixels);
+static void _gaussianBlur(SDL_Surface* in, SDL_Surface* out, int radius, bool repeatEdgePixels,
+                          BlurQuality quality);
+static void _flipPixels(SDL_Surface* in, SDL_Surface* out, bool flipX, bool flipY);
+static void _rotateQuarter(SDL_Surface* in, SDL_Surface* out, int turns);
+static void _rotozoomPixels(SDL_Surface* in, SDL_Surface* out, double angle, double scale,
+                            bool smooth, bool premultiplied);
+static void _resampleArea(SDL_Surface* in, SDL_Surface* out, bool premultiplied);
+static void _pointPass(SDL_Surface* in, SDL_Surface* out, const transform::Pipeline::Stage* stages,
+                       size_t count, bool premultiplied);
+static void _boxBlurPass(const uint8_t* src, int srcPitch, uint8_t* dst, int dstPitch,
+                         int length, int lines, int radius, bool repeatEdgePixels);
+static void _gaussianPass(const uint8_t* src, int srcPitch, uint8_t* dst, int dstPitch,
+                          int length, int lines, const std::vector<int16_t>& kernel,
+                          bool repeatEdgePixels);
 
 namespace transform
 {
@@ -12,6 +51,7 @@ void _bind(py::module_& module)
     auto subTransform = module.def_submodule("transform", "Functions for transforming pixel arrays");
 
     subTransform.def("flip", &flip, py::arg("pixel_array"), py::arg("flip_x"), py::arg("flip_y"),
+                     py::kw_only(), py::arg("dst") = py::none(), py::arg("inplace") = false,
                      R"doc(
 Flip a pixel array horizontally, vertically, or both.
 
@@ -19,111 +59,208 @@ Args:
     pixel_array (PixelArray): The pixel array to flip.
     flip_x (bool): Whether to flip horizontally (mirror left-right).
     flip_y (bool): Whether to flip vertically (mirror top-bottom).
+    dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                when the size matches, otherwise it is reallocated.
+    inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
 
 Returns:
-    PixelArray: A new pixel array with the flipped image.
+    PixelArray: The flipped image, in dst or pixel_array if given, otherwise a new pixel array.
 
 Raises:
+    ValueError: If both dst and inplace are given.
     RuntimeError: If pixel array creation fails.
     )doc");
-    subTransform.def("scale_to", &scaleTo, py::arg("pixel_array"), py::arg("size"), R"doc(
+    subTransform.def("scale_to", &scaleTo, py::arg("pixel_array"), py::arg("size"),
+                     py::arg("smooth") = false, py::kw_only(), py::arg("dst") = py::none(),
+                     py::arg("inplace") = false, R"doc(
 Scale a pixel array to a new exact size.
 
 Args:
     pixel_array (PixelArray): The pixel array to scale.
     size (Vec2): The target size as (width, height).
+    smooth (bool, optional): Whether to average the source pixels covered by each output pixel
+                             instead of taking the nearest one. Defaults to False.
+    dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                when the size matches, otherwise it is reallocated.
+    inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
 
 Returns:
-    PixelArray: A new pixel array scaled to the specified size.
+    PixelArray: The scaled image, in dst or pixel_array if given, otherwise a new pixel array.
 
 Raises:
+    ValueError: If both dst and inplace are given.
     RuntimeError: If pixel array creation or scaling fails.
     )doc");
-    subTransform.def("scale_by", py::overload_cast<const PixelArray&, double>(&scaleBy),
-                     py::arg("pixel_array"), py::arg("factor"), R"doc(
+    subTransform.def(
+        "scale_by",
+        py::overload_cast<const PixelArray&, double, bool, const py::object&, bool>(&scaleBy),
+        py::arg("pixel_array"), py::arg("factor"), py::arg("smooth") = false, py::kw_only(),
+        py::arg("dst") = py::none(), py::arg("inplace") = false, R"doc(
 Scale a pixel array by a given factor.
 
 Args:
     pixel_array (PixelArray): The pixel array to scale.
     factor (float): The scaling factor (must be > 0). Values > 1.0 enlarge,
                    values < 1.0 shrink the pixel array.
+    smooth (bool, optional): Whether to average the source pixels covered by each output pixel
+                             instead of taking the nearest one. Defaults to False.
+    dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                when the size matches, otherwise it is reallocated.
+    inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
 
 Returns:
-    PixelArray: A new pixel array scaled by the specified factor.
+    PixelArray: The scaled image, in dst or pixel_array if given, otherwise a new pixel array.
 
 Raises:
-    ValueError: If factor is <= 0.
+    ValueError: If factor is <= 0, or if both dst and inplace are given.
     RuntimeError: If pixel array creation or scaling fails.
     )doc");
-    subTransform.def("rotate", &rotate, py::arg("pixel_array"), py::arg("angle"), R"doc(
+    subTransform.def("build_mips", &buildMips, py::arg("pixel_array"), R"doc(
+Build a mip chain of successively half-size copies of a pixel array.
+
+Each level is the area average of the one before it, computed on worker threads with SIMD
+instructions where available. Odd sizes round down, and the chain ends at 1x1.
+
+Args:
+    pixel_array (PixelArray): The full-size image, which becomes level 0.
+
+Returns:
+    list[PixelArray]: The levels from largest to smallest, starting with pixel_array itself.
+
+Raises:
+    RuntimeError: If pixel array creation fails.
+    )doc");
+    subTransform.def("rotate", &rotate, py::arg("pixel_array"), py::arg("angle"),
+                     py::arg("smooth") = false, py::kw_only(), py::arg("dst") = py::none(),
+                     py::arg("inplace") = false, R"doc(
 Rotate a pixel array by a given angle.
 
 Args:
     pixel_array (PixelArray): The pixel array to rotate.
-    angle (float): The rotation angle in degrees. Positive values rotate clockwise.
+    angle (float): The rotation angle in degrees. Positive values rotate counter-clockwise.
+                   Multiples of 90 are exact and keep the image's size (or swap its width
+                   and height).
+    smooth (bool, optional): Whether to filter with bilinear interpolation instead of taking
+                             the nearest pixel. Defaults to False.
+    dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                when the size matches, otherwise it is reallocated.
+    inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
 
 Returns:
-    PixelArray: A new pixel array containing the rotated image. The output pixel array may be
-            larger than the input to accommodate the rotated image.
+    PixelArray: The rotated image, in dst or pixel_array if given, otherwise a new pixel array.
+                The output is sized to the rotated image's bounding box, and pixels outside
+                the source are transparent.
 
 Raises:
-    RuntimeError: If pixel array rotation fails.
+    ValueError: If both dst and inplace are given.
+    RuntimeError: If pixel array creation fails.
+    )doc");
+    subTransform.def("rotozoom", &rotozoom, py::arg("pixel_array"), py::arg("angle"),
+                     py::arg("scale"), py::arg("smooth") = true, py::kw_only(),
+                     py::arg("dst") = py::none(), py::arg("inplace") = false, R"doc(
+Rotate and scale a pixel array in a single pass.
+
+The work is split across worker threads, and bilinear filtering uses SIMD instructions
+where available.
+
+Args:
+    pixel_array (PixelArray): The pixel array to transform.
+    angle (float): The rotation angle in degrees. Positive values rotate counter-clockwise.
+    scale (float): The scale factor (must be > 0).
+    smooth (bool, optional): Whether to filter with bilinear interpolation instead of taking
+                             the nearest pixel. Defaults to True.
+    dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                when the size matches, otherwise it is reallocated.
+    inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
+
+Returns:
+    PixelArray: The transformed image, in dst or pixel_array if given, otherwise a new pixel
+                array sized to the transformed image's bounding box.
+
+Raises:
+    ValueError: If scale is <= 0, or if both dst and inplace are given.
+    RuntimeError: If pixel array creation fails.
     )doc");
     subTransform.def("box_blur", &boxBlur, py::arg("pixel_array"), py::arg("radius"),
-                     py::arg("repeat_edge_pixels") = true, R"doc(
+                     py::arg("repeat_edge_pixels") = true, py::kw_only(),
+                     py::arg("dst") = py::none(), py::arg("inplace") = false, R"doc(
 Apply a box blur effect to a pixel array.
 
 Box blur creates a uniform blur effect by averaging pixels within a square kernel.
 It's faster than Gaussian blur but produces a more uniform, less natural look.
+The cost per pixel does not depend on the radius.
 
 Args:
     pixel_array (PixelArray): The pixel array to blur.
     radius (int): The blur radius in pixels. Larger values create stronger blur.
     repeat_edge_pixels (bool, optional): Whether to repeat edge pixels when sampling
-                                        outside the pixel array bounds. Defaults to True.
+                                        outside the pixel array bounds. Otherwise pixels
+                                        outside are transparent black. Defaults to True.
+    dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                when the size matches, otherwise it is reallocated.
+    inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
 
 Returns:
-    PixelArray: A new pixel array with the box blur effect applied.
+    PixelArray: The blurred image, in dst or pixel_array if given, otherwise a new pixel array.
 
 Raises:
+    ValueError: If radius is negative, or if both dst and inplace are given.
     RuntimeError: If pixel array creation fails during the blur process.
     )doc");
     subTransform.def("gaussian_blur", &gaussianBlur, py::arg("pixel_array"), py::arg("radius"),
-                     py::arg("repeat_edge_pixels") = true, R"doc(
+                     py::arg("repeat_edge_pixels") = true, py::arg("quality") = BlurQuality::EXACT,
+                     py::kw_only(), py::arg("dst") = py::none(), py::arg("inplace") = false,
+                     R"doc(
 Apply a Gaussian blur effect to a pixel array.
 
 Gaussian blur creates a natural, smooth blur effect using a Gaussian distribution
 for pixel weighting. It produces higher quality results than box blur but is
 computationally more expensive.
 
+With BlurQuality.EXACT the full kernel is applied, so the cost grows with the radius.
+BlurQuality.FAST approximates the Gaussian with three successive box blurs whose cost
+does not depend on the radius, which suits large radii.
+
 Args:
     pixel_array (PixelArray): The pixel array to blur.
     radius (int): The blur radius in pixels. Larger values create stronger blur.
     repeat_edge_pixels (bool, optional): Whether to repeat edge pixels when sampling
                                         outside the pixel array bounds. Defaults to True.
+    quality (BlurQuality, optional): The quality/speed trade-off. Defaults to EXACT.
+    dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                when the size matches, otherwise it is reallocated.
+    inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
 
 Returns:
-    PixelArray: A new pixel array with the Gaussian blur effect applied.
+    PixelArray: The blurred image, in dst or pixel_array if given, otherwise a new pixel array.
 
 Raises:
+    ValueError: If radius is negative, or if both dst and inplace are given.
     RuntimeError: If pixel array creation fails during the blur process.
     )doc");
-    subTransform.def("invert", &invert, py::arg("pixel_array"), R"doc(
+    subTransform.def("invert", &invert, py::arg("pixel_array"), py::kw_only(),
+                     py::arg("dst") = py::none(), py::arg("inplace") = false, R"doc(
 Invert the colors of a pixel array.
 
 Creates a negative image effect by inverting each color channel (RGB).
-The alpha channel is preserved unchanged.
+The alpha channel is preserved unchanged. Premultiplied colors are inverted against
+their alpha, so the result stays premultiplied.
 
 Args:
     pixel_array (PixelArray): The pixel array to invert.
+    dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                when the size matches, otherwise it is reallocated.
+    inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
 
 Returns:
-    PixelArray: A new pixel array with inverted colors.
+    PixelArray: The inverted image, in dst or pixel_array if given, otherwise a new pixel array.
 
 Raises:
+    ValueError: If both dst and inplace are given.
     RuntimeError: If pixel array creation fails.
     )doc");
-    subTransform.def("grayscale", &grayscale, py::arg("pixel_array"), R"doc(
+    subTransform.def("grayscale", &grayscale, py::arg("pixel_array"), py::kw_only(),
+                     py::arg("dst") = py::none(), py::arg("inplace") = false, R"doc(
 Convert a pixel array to grayscale.
 
 Converts the pixel array to grayscale using the standard luminance formula:
@@ -134,317 +271,1785 @@ The alpha channel is preserved unchanged.
 
 Args:
     pixel_array (PixelArray): The pixel array to convert to grayscale.
+    dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                when the size matches, otherwise it is reallocated.
+    inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
 
 Returns:
-    PixelArray: A new pixel array converted to grayscale.
+    PixelArray: The grayscale image, in dst or pixel_array if given, otherwise a new pixel
+                array.
 
 Raises:
+    ValueError: If both dst and inplace are given.
     RuntimeError: If pixel array creation fails.
     )doc");
-}
 
-std::unique_ptr<PixelArray> flip(const PixelArray& pixelArray, const bool flipX, const bool flipY)
-{
-    SDL_Surface* sdlSurface = pixelArray.getSDL();
-    SDL_Surface* flipped = SDL_CreateSurface(sdlSurface->w, sdlSurface->h, SDL_PIXELFORMAT_RGBA32);
+    py::classh<Pipeline>(subTransform, "Pipeline", R"doc(
+A reusable chain of pixel operations applied in as few passes as possible.
 
-    if (!flipped)
-        throw std::runtime_error("Failed to create flipped pixel array.");
+Operations are added with chainable methods and run in order by apply. Adjacent color
+operations (invert, grayscale, brightness, contrast, color_matrix, tint, alpha_multiply)
+are folded into a single color matrix, and every run of color and threshold operations
+between blurs is applied in one pass over the pixels. Intermediate colors within a folded
+matrix are not clamped. Color operations on a premultiplied pixel array work on its straight
+colors, and the result is premultiplied again.
 
-    int bpp = SDL_GetPixelFormatDetails(sdlSurface->format)->bytes_per_pixel;
+Example:
+    flash = transform.Pipeline().grayscale().brightness(0.4).tint(Color(255, 80, 80))
+    flash.apply(sprite_pixels, dst=flash_pixels)
+    )doc")
+        .def(py::init<>(), R"doc(
+Create an empty pipeline.
+        )doc")
 
-    for (int y = 0; y < sdlSurface->h; ++y)
-        for (int x = 0; x < sdlSurface->w; ++x)
-        {
-            int srcX = flipX ? (sdlSurface->w - 1 - x) : x;
-            int srcY = flipY ? (sdlSurface->h - 1 - y) : y;
+        .def_property_readonly("pass_count", &Pipeline::getPassCount, R"doc(
+The number of passes over the pixels apply performs, counting each blur as one.
+        )doc")
 
-            Uint8* srcPixel = (Uint8*)sdlSurface->pixels + srcY * sdlSurface->pitch + srcX * bpp;
-            Uint8* dstPixel = (Uint8*)flipped->pixels + y * flipped->pitch + x * bpp;
+        .def("invert", &Pipeline::invert, py::return_value_policy::reference_internal, R"doc(
+Add an operation that inverts the RGB channels.
 
-            memcpy(dstPixel, srcPixel, bpp);
-        }
+Returns:
+    Pipeline: This pipeline, for chaining.
+        )doc")
+        .def("grayscale", &Pipeline::grayscale, py::return_value_policy::reference_internal,
+             R"doc(
+Add an operation that converts to grayscale using the same weights as transform.grayscale.
+
+Returns:
+    Pipeline: This pipeline, for chaining.
+        )doc")
+        .def("brightness", &Pipeline::brightness, py::arg("amount"),
+             py::return_value_policy::reference_internal, R"doc(
+Add an operation that brightens or darkens the RGB channels.
+
+Args:
+    amount (float): The amount added to each channel, from -1.0 (black) to 1.0 (white).
+
+Returns:
+    Pipeline: This pipeline, for chaining.
+        )doc")
+        .def("contrast", &Pipeline::contrast, py::arg("factor"),
+             py::return_value_policy::reference_internal, R"doc(
+Add an operation that scales the RGB channels' distance from mid-gray.
+
+Args:
+    factor (float): The contrast factor. 1.0 leaves the image unchanged, values below 1.0
+                    reduce and values above 1.0 increase the contrast.
+
+Returns:
+    Pipeline: This pipeline, for chaining.
+
+Raises:
+    ValueError: If factor is negative.
+        )doc")
+        .def("color_matrix", &Pipeline::colorMatrix, py::arg("matrix"),
+             py::return_value_policy::reference_internal, R"doc(
+Add an operation that multiplies each RGBA color by a matrix.
+
+Each output channel is the dot product of a matrix row with the input (r, g, b, a), plus
+the row's fifth element as an offset when given.
+
+Args:
+    matrix (numpy.ndarray | Sequence): A (4, 4) or (4, 5) matrix. Offsets are in the
+                                       0.0-1.0 range.
+
+Returns:
+    Pipeline: This pipeline, for chaining.
+
+Raises:
+    ValueError: If the matrix shape is invalid.
+        )doc")
+        .def("tint", &Pipeline::tint, py::arg("color"),
+             py::return_value_policy::reference_internal, R"doc(
+Add an operation that multiplies each channel by a color.
+
+Args:
+    color (Color): The tint color. Its alpha multiplies the alpha channel.
+
+Returns:
+    Pipeline: This pipeline, for chaining.
+        )doc")
+        .def("alpha_multiply", &Pipeline::alphaMultiply, py::arg("factor"),
+             py::return_value_policy::reference_internal, R"doc(
+Add an operation that multiplies the alpha channel.
+
+Args:
+    factor (float): The alpha factor.
+
+Returns:
+    Pipeline: This pipeline, for chaining.
+
+Raises:
+    ValueError: If factor is negative.
+        )doc")
+        .def("threshold", &Pipeline::threshold, py::arg("level"),
+             py::return_value_policy::reference_internal, R"doc(
+Add an operation that sets each RGB channel to 255 if it is at least level, otherwise 0.
+
+Args:
+    level (int): The threshold level from 0 to 255.
+
+Returns:
+    Pipeline: This pipeline, for chaining.
+
+Raises:
+    ValueError: If level is out of range.
+        )doc")
+        .def("box_blur", &Pipeline::boxBlur, py::arg("radius"),
+             py::arg("repeat_edge_pixels") = true, py::return_value_policy::reference_internal,
+             R"doc(
+Add a box blur pass. See transform.box_blur.
 
-    return std::make_unique<PixelArray>(flipped);
+Args:
+    radius (int): The blur radius in pixels.
+    repeat_edge_pixels (bool, optional): Whether to repeat edge pixels when sampling
+                                        outside the bounds. Defaults to True.
+
+Returns:
+    Pipeline: This pipeline, for chaining.
+
+Raises:
+    ValueError: If radius is negative.
+        )doc")
+        .def("gaussian_blur", &Pipeline::gaussianBlur, py::arg("radius"),
+             py::arg("repeat_edge_pixels") = true, py::arg("quality") = BlurQuality::EXACT,
+             py::return_value_policy::reference_internal, R"doc(
+Add a Gaussian blur pass. See transform.gaussian_blur.
+
+Args:
+    radius (int): The blur radius in pixels.
+    repeat_edge_pixels (bool, optional): Whether to repeat edge pixels when sampling
+                                        outside the bounds. Defaults to True.
+    quality (BlurQuality, optional): The quality/speed trade-off. Defaults to EXACT.
+
+Returns:
+    Pipeline: This pipeline, for chaining.
+
+Raises:
+    ValueError: If radius is negative.
+        )doc")
+        .def("clear", &Pipeline::clear, R"doc(
+Remove all operations.
+        )doc")
+        .def("apply", &Pipeline::apply, py::arg("pixel_array"), py::kw_only(),
+             py::arg("dst") = py::none(), py::arg("inplace") = false, R"doc(
+Run the pipeline on a pixel array.
+
+Args:
+    pixel_array (PixelArray): The source pixel array.
+    dst (PixelArray, optional): A pixel array to write the result into. Its memory is reused
+                                when the size matches, otherwise it is reallocated.
+    inplace (bool, optional): Whether to write the result into pixel_array. Defaults to False.
+
+Returns:
+    PixelArray: The result, in dst or pixel_array if given, otherwise a new pixel array.
+
+Raises:
+    ValueError: If both dst and inplace are given.
+    RuntimeError: If pixel array creation fails.
+        )doc");
 }
 
-std::unique_ptr<PixelArray> scaleTo(const PixelArray& pixelArray, const Vec2& size)
+py::object flip(const PixelArray& pixelArray, const bool flipX, const bool flipY,
+                const py::object& dst, const bool inplace)
 {
-    SDL_Surface* sdlSurface = pixelArray.getSDL();
+    SDL_Surface* src = pixelArray.getSDL();
 
+    return _transform(pixelArray, dst, inplace, src->w, src->h, false,
+                      [&](SDL_Surface* in, SDL_Surface* out)
+                      { _flipPixels(in, out, flipX, flipY); });
+}
+
+py::object scaleTo(const PixelArray& pixelArray, const Vec2& size, const bool smooth,
+                   const py::object& dst, const bool inplace)
+{
     const auto newW = static_cast<int>(size.x);
     const auto newH = static_cast<int>(size.y);
-
-    SDL_Surface* scaled = SDL_CreateSurface(newW, newH, SDL_PIXELFORMAT_RGBA32);
-    if (!scaled)
-        throw std::runtime_error("Failed to create scaled pixel array.");
-
-    SDL_Rect dstRect = {0, 0, newW, newH};
-    if (!SDL_BlitSurfaceScaled(sdlSurface, nullptr, scaled, &dstRect, SDL_SCALEMODE_NEAREST))
-    {
-        SDL_DestroySurface(scaled);
-        throw std::runtime_error("SDL_BlitScaled failed: " + std::string(SDL_GetError()));
-    }
-
-    return std::make_unique<PixelArray>(scaled);
+    const bool premultiplied = pixelArray.isPremultiplied();
+
+    return _transform(pixelArray, dst, inplace, newW, newH, false,
+                      [&](SDL_Surface* in, SDL_Surface* out)
+                      {
+                          if (smooth)
+                          {
+                              _resampleArea(in, out, premultiplied);
+                              return;
+                          }
+
+                          // Copy rather than blend, since the output may hold stale pixels
+                          SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+                          SDL_GetSurfaceBlendMode(in, &blendMode);
+                          SDL_SetSurfaceBlendMode(in, SDL_BLENDMODE_NONE);
+
+                          SDL_Rect dstRect = {0, 0, newW, newH};
+                          const bool ok = SDL_BlitSurfaceScaled(in, nullptr, out, &dstRect,
+                                                                SDL_SCALEMODE_NEAREST);
+                          SDL_SetSurfaceBlendMode(in, blendMode);
+
+                          if (!ok)
+                              throw std::runtime_error("SDL_BlitScaled failed: " +
+                                                       std::string(SDL_GetError()));
+                      });
 }
 
-std::unique_ptr<PixelArray> scaleBy(const PixelArray& pixelArray, const double factor)
+py::object scaleBy(const PixelArray& pixelArray, const double factor, const bool smooth,
+                   const py::object& dst, const bool inplace)
 {
     if (factor <= 0.0)
         throw std::invalid_argument("Scale factor must be a positive value.");
 
-    return scaleTo(pixelArray, pixelArray.getSize() * factor);
+    return scaleTo(pixelArray, pixelArray.getSize() * factor, smooth, dst, inplace);
 }
 
-std::unique_ptr<PixelArray> scaleBy(const PixelArray& pixelArray, const Vec2& factor)
+py::object scaleBy(const PixelArray& pixelArray, const Vec2& factor, const bool smooth,
+                   const py::object& dst, const bool inplace)
 {
     if (factor <= 0.0)
         throw std::invalid_argument("Scale factor must be a positive value.");
 
     const Vec2 originalSize = pixelArray.getSize();
-    return scaleTo(pixelArray, {originalSize.x * factor.x, originalSize.y * factor.y});
+    return scaleTo(pixelArray, {originalSize.x * factor.x, originalSize.y * factor.y}, smooth,
+                   dst, inplace);
 }
 
-std::unique_ptr<PixelArray> rotate(const PixelArray& pixelArray, const double angle)
+py::list buildMips(const PixelArray& pixelArray)
 {
-    SDL_Surface* sdlSurface = pixelArray.getSDL();
-    SDL_Surface* rotated =
-        rotozoomSurface(sdlSurface, angle, 1.0, SMOOTHING_OFF); // rotate, don't scale
-    if (!rotated)
-        throw std::runtime_error("Failed to rotate pixel array.");
+    py::list levels;
+    levels.append(py::cast(pixelArray, py::return_value_policy::reference));
+
+    SDL_Surface* level = _toRGBA32(pixelArray.getSDL());
+    if (!level)
+        throw std::runtime_error("Failed to convert surface: " + std::string(SDL_GetError()));
+
+    const bool premultiplied = pixelArray.isPremultiplied();
+    bool ownsLevel = level != pixelArray.getSDL();
+    while (level->w > 1 || level->h > 1)
+    {
+        SDL_Surface* next = SDL_CreateSurface(std::max(1, level->w / 2), std::max(1, level->h / 2),
+                                              SDL_PIXELFORMAT_RGBA32);
+        if (!next)
+        {
+            if (ownsLevel)
+                SDL_DestroySurface(level);
+            throw std::runtime_error("Failed to create mip level: " +
+                                     std::string(SDL_GetError()));
+        }
+
+        // Each level reads the one before it, so every halving only touches four pixels each
+        _resampleArea(level, next, premultiplied);
+        if (ownsLevel)
+            SDL_DestroySurface(level);
+
+        auto mip = std::make_unique<PixelArray>(next);
+        mip->setPremultiplied(premultiplied);
+        levels.append(py::cast(std::move(mip)));
 
-    return std::make_unique<PixelArray>(rotated);
+        level = next;
+        ownsLevel = false;
+    }
+
+    return levels;
 }
 
-std::unique_ptr<PixelArray> boxBlur(const PixelArray& pixelArray, const int radius,
-                                 const bool repeatEdgePixels)
+py::object rotate(const PixelArray& pixelArray, const double angle, const bool smooth,
+                  const py::object& dst, const bool inplace)
 {
+    return rotozoom(pixelArray, angle, 1.0, smooth, dst, inplace);
+}
+
+py::object rotozoom(const PixelArray& pixelArray, const double angle, const double scale,
+                    const bool smooth, const py::object& dst, const bool inplace)
+{
+    if (scale <= 0.0)
+        throw std::invalid_argument("Scale must be a positive value.");
+
     SDL_Surface* src = pixelArray.getSDL();
-    const int width = src->w;
-    const int height = src->h;
 
-    SDL_Surface* temp = SDL_CreateSurface(width, height, src->format);
-    SDL_Surface* result = SDL_CreateSurface(width, height, src->format);
-    if (!temp || !result)
-        throw std::runtime_error("Failed to create surfaces for box blur.");
+    // Unscaled multiples of 90 degrees move whole pixels, so they skip resampling
+    const double turns = angle / 90.0;
+    if (scale == 1.0 && turns == std::floor(turns) && std::abs(turns) < 1e9)
+    {
+        const int quarter = static_cast<int>(((static_cast<long long>(turns) % 4) + 4) % 4);
+        const bool swapSize = quarter % 2 == 1;
+
+        return _transform(pixelArray, dst, inplace, swapSize ? src->h : src->w,
+                          swapSize ? src->w : src->h, false,
+                          [&](SDL_Surface* in, SDL_Surface* out)
+                          {
+                              if (swapSize)
+                                  _rotateQuarter(in, out, quarter);
+                              else
+                                  _flipPixels(in, out, quarter == 2, quarter == 2);
+                          });
+    }
+
+    // Bounding box of the rotated, scaled source
+    const double radians = angle * (M_PI / 180.0);
+    const double cosA = std::abs(std::cos(radians));
+    const double sinA = std::abs(std::sin(radians));
+    const int width =
+        std::max(1, static_cast<int>(std::ceil((src->w * cosA + src->h * sinA) * scale - 1e-4)));
+    const int height =
+        std::max(1, static_cast<int>(std::ceil((src->w * sinA + src->h * cosA) * scale - 1e-4)));
+
+    const bool premultiplied = pixelArray.isPremultiplied();
+    return _transform(pixelArray, dst, inplace, width, height, false,
+                      [&](SDL_Surface* in, SDL_Surface* out)
+                      { _rotozoomPixels(in, out, angle, scale, smooth, premultiplied); });
+}
 
-    auto clamp = [](const int v, const int low, const int high) -> int
-    { return std::max(low, std::min(v, high)); };
+py::object boxBlur(const PixelArray& pixelArray, const int radius, const bool repeatEdgePixels,
+                   const py::object& dst, const bool inplace)
+{
+    if (radius < 0)
+        throw std::invalid_argument("Blur radius cannot be negative.");
 
-    auto* srcPx = static_cast<uint32_t*>(src->pixels);
-    auto* tmpPx = static_cast<uint32_t*>(temp->pixels);
-    auto* dstPx = static_cast<uint32_t*>(result->pixels);
+    SDL_Surface* src = pixelArray.getSDL();
 
-    const int diameter = radius * 2 + 1;
-    const auto srcDetails = SDL_GetPixelFormatDetails(src->format);
-    const auto tmpDetails = SDL_GetPixelFormatDetails(temp->format);
-    const auto resDetails = SDL_GetPixelFormatDetails(result->format);
+    return _transform(pixelArray, dst, inplace, src->w, src->h, true,
+                      [&](SDL_Surface* in, SDL_Surface* out)
+                      { _boxBlur(in, out, radius, repeatEdgePixels); });
+}
 
-    // Horizontal
-    for (int y = 0; y < height; ++y)
-        for (int x = 0; x < width; ++x)
+py::object gaussianBlur(const PixelArray& pixelArray, const int radius,
+                        const bool repeatEdgePixels, const BlurQuality quality,
+                        const py::object& dst, const bool inplace)
+{
+    if (radius < 0)
+        throw std::invalid_argument("Blur radius cannot be negative.");
+
+    SDL_Surface* src = pixelArray.getSDL();
+
+    return _transform(pixelArray, dst, inplace, src->w, src->h, true,
+                      [&](SDL_Surface* in, SDL_Surface* out)
+                      { _gaussianBlur(in, out, radius, repeatEdgePixels, quality); });
+}
+
+py::object invert(const PixelArray& pixelArray, const py::object& dst, const bool inplace)
+{
+    SDL_Surface* src = pixelArray.getSDL();
+    const bool premultiplied = pixelArray.isPremultiplied();
+
+    return _transform(pixelArray, dst, inplace, src->w, src->h, true,
+                      [premultiplied](SDL_Surface* in, SDL_Surface* out)
+                      {
+                          for (int y = 0; y < in->h; ++y)
+                          {
+                              const auto* srcRow =
+                                  static_cast<const uint8_t*>(in->pixels) + y * in->pitch;
+                              auto* dstRow = static_cast<uint8_t*>(out->pixels) + y * out->pitch;
+
+                              for (int x = 0; x < in->w * 4; x += 4)
+                              {
+                                  // Premultiplied colors invert against alpha, which is
+                                  // 255 - c scaled by a / 255
+                                  const uint8_t full = premultiplied ? srcRow[x + 3] : 255;
+                                  for (int c = 0; c < 3; ++c)
+                                      dstRow[x + c] = static_cast<uint8_t>(
+                                          full - std::min(full, srcRow[x + c]));
+                                  dstRow[x + 3] = srcRow[x + 3];
+                              }
+                          }
+                      });
+}
+
+py::object grayscale(const PixelArray& pixelArray, const py::object& dst, const bool inplace)
+{
+    SDL_Surface* src = pixelArray.getSDL();
+
+    return _transform(pixelArray, dst, inplace, src->w, src->h, true,
+                      [](SDL_Surface* in, SDL_Surface* out)
+                      {
+                          for (int y = 0; y < in->h; ++y)
+                          {
+                              const auto* srcRow =
+                                  static_cast<const uint8_t*>(in->pixels) + y * in->pitch;
+                              auto* dstRow = static_cast<uint8_t*>(out->pixels) + y * out->pitch;
+
+                              for (int x = 0; x < in->w * 4; x += 4)
+                              {
+                                  // 0.299, 0.587 and 0.114 in 16.16 fixed point
+                                  const auto gray = static_cast<uint8_t>(
+                                      (19595 * srcRow[x] + 38470 * srcRow[x + 1] +
+                                       7471 * srcRow[x + 2]) >> 16);
+                                  dstRow[x] = gray;
+                                  dstRow[x + 1] = gray;
+                                  dstRow[x + 2] = gray;
+                                  dstRow[x + 3] = srcRow[x + 3];
+                              }
+                          }
+                      });
+}
+
+Pipeline& Pipeline::invert()
+{
+    const float matrix[4][5] = {
+        {-1.f, 0.f, 0.f, 0.f, 255.f},
+        {0.f, -1.f, 0.f, 0.f, 255.f},
+        {0.f, 0.f, -1.f, 0.f, 255.f},
+        {0.f, 0.f, 0.f, 1.f, 0.f},
+    };
+    return addMatrix(matrix);
+}
+
+Pipeline& Pipeline::grayscale()
+{
+    const float matrix[4][5] = {
+        {0.299f, 0.587f, 0.114f, 0.f, 0.f},
+        {0.299f, 0.587f, 0.114f, 0.f, 0.f},
+        {0.299f, 0.587f, 0.114f, 0.f, 0.f},
+        {0.f, 0.f, 0.f, 1.f, 0.f},
+    };
+    return addMatrix(matrix);
+}
+
+Pipeline& Pipeline::brightness(const double amount)
+{
+    const auto offset = static_cast<float>(amount * 255.0);
+    const float matrix[4][5] = {
+        {1.f, 0.f, 0.f, 0.f, offset},
+        {0.f, 1.f, 0.f, 0.f, offset},
+        {0.f, 0.f, 1.f, 0.f, offset},
+        {0.f, 0.f, 0.f, 1.f, 0.f},
+    };
+    return addMatrix(matrix);
+}
+
+Pipeline& Pipeline::contrast(const double factor)
+{
+    if (factor < 0.0)
+        throw std::invalid_argument("Contrast factor cannot be negative.");
+
+    const auto scale = static_cast<float>(factor);
+    const float offset = 128.f * (1.f - scale);
+    const float matrix[4][5] = {
+        {scale, 0.f, 0.f, 0.f, offset},
+        {0.f, scale, 0.f, 0.f, offset},
+        {0.f, 0.f, scale, 0.f, offset},
+        {0.f, 0.f, 0.f, 1.f, 0.f},
+    };
+    return addMatrix(matrix);
+}
+
+Pipeline& Pipeline::colorMatrix(
+    py::array_t<float, py::array::c_style | py::array::forcecast> matrix)
+{
+    if (matrix.ndim() != 2 || matrix.shape(0) != 4 ||
+        (matrix.shape(1) != 4 && matrix.shape(1) != 5))
+        throw std::invalid_argument("Color matrix must have shape (4, 4) or (4, 5).");
+
+    const auto cols = static_cast<int>(matrix.shape(1));
+    const float* data = matrix.data();
+
+    float converted[4][5] = {};
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int col = 0; col < 4; ++col)
+            converted[row][col] = data[row * cols + col];
+        if (cols == 5)
+            converted[row][4] = data[row * cols + 4] * 255.f;
+    }
+    return addMatrix(converted);
+}
+
+Pipeline& Pipeline::tint(const Color& color)
+{
+    const float matrix[4][5] = {
+        {color.r / 255.f, 0.f, 0.f, 0.f, 0.f},
+        {0.f, color.g / 255.f, 0.f, 0.f, 0.f},
+        {0.f, 0.f, color.b / 255.f, 0.f, 0.f},
+        {0.f, 0.f, 0.f, color.a / 255.f, 0.f},
+    };
+    return addMatrix(matrix);
+}
+
+Pipeline& Pipeline::alphaMultiply(const double factor)
+{
+    if (factor < 0.0)
+        throw std::invalid_argument("Alpha factor cannot be negative.");
+
+    const float matrix[4][5] = {
+        {1.f, 0.f, 0.f, 0.f, 0.f},
+        {0.f, 1.f, 0.f, 0.f, 0.f},
+        {0.f, 0.f, 1.f, 0.f, 0.f},
+        {0.f, 0.f, 0.f, static_cast<float>(factor), 0.f},
+    };
+    return addMatrix(matrix);
+}
+
+Pipeline& Pipeline::threshold(const int level)
+{
+    if (level < 0 || level > 255)
+        throw std::invalid_argument("Threshold level must be between 0 and 255.");
+
+    Stage stage;
+    stage.kind = Stage::Kind::THRESHOLD;
+    stage.level = static_cast<float>(level);
+    m_stages.push_back(stage);
+    return *this;
+}
+
+Pipeline& Pipeline::boxBlur(const int radius, const bool repeatEdgePixels)
+{
+    if (radius < 0)
+        throw std::invalid_argument("Blur radius cannot be negative.");
+
+    Stage stage;
+    stage.kind = Stage::Kind::BOX_BLUR;
+    stage.radius = radius;
+    stage.repeatEdgePixels = repeatEdgePixels;
+    m_stages.push_back(stage);
+    return *this;
+}
+
+Pipeline& Pipeline::gaussianBlur(const int radius, const bool repeatEdgePixels,
+                                 const BlurQuality quality)
+{
+    if (radius < 0)
+        throw std::invalid_argument("Blur radius cannot be negative.");
+
+    Stage stage;
+    stage.kind = Stage::Kind::GAUSSIAN_BLUR;
+    stage.radius = radius;
+    stage.repeatEdgePixels = repeatEdgePixels;
+    stage.quality = quality;
+    m_stages.push_back(stage);
+    return *this;
+}
+
+void Pipeline::clear() { m_stages.clear(); }
+
+int Pipeline::getPassCount() const
+{
+    int passes = 0;
+    bool inPointRun = false;
+    for (const Stage& stage : m_stages)
+    {
+        const bool isPoint =
+            stage.kind == Stage::Kind::MATRIX || stage.kind == Stage::Kind::THRESHOLD;
+        if (!isPoint || !inPointRun)
+            ++passes;
+        inPointRun = isPoint;
+    }
+    return passes;
+}
+
+py::object Pipeline::apply(const PixelArray& pixelArray, const py::object& dst,
+                           const bool inplace) const
+{
+    SDL_Surface* src = pixelArray.getSDL();
+    const bool premultiplied = pixelArray.isPremultiplied();
+
+    return _transform(
+        pixelArray, dst, inplace, src->w, src->h, true,
+        [this, premultiplied](SDL_Surface* in, SDL_Surface* out)
         {
-            uint8_t r = 0, g = 0, b = 0, a = 0;
-            for (int dx = -radius; dx <= radius; ++dx)
+            // Every pass reads the previous result, so only the first one reads the input
+            SDL_Surface* current = in;
+            size_t i = 0;
+            while (i < m_stages.size())
             {
-                int sx = repeatEdgePixels ? clamp(x + dx, 0, width - 1) : x + dx;
-                if (sx < 0 || sx >= width)
-                    continue;
-
-                uint8_t pr, pg, pb, pa;
-                SDL_GetRGBA(srcPx[y * width + sx], srcDetails, nullptr, &pr, &pg, &pb, &pa);
-                r += pr;
-                g += pg;
-                b += pb;
-                a += pa;
+                const Stage& stage = m_stages[i];
+                if (stage.kind == Stage::Kind::BOX_BLUR)
+                {
+                    _boxBlur(current, out, stage.radius, stage.repeatEdgePixels);
+                    ++i;
+                }
+                else if (stage.kind == Stage::Kind::GAUSSIAN_BLUR)
+                {
+                    _gaussianBlur(current, out, stage.radius, stage.repeatEdgePixels,
+                                  stage.quality);
+                    ++i;
+                }
+                else
+                {
+                    size_t end = i;
+                    while (end < m_stages.size() && (m_stages[end].kind == Stage::Kind::MATRIX ||
+                                                     m_stages[end].kind == Stage::Kind::THRESHOLD))
+                        ++end;
+                    _pointPass(current, out, &m_stages[i], end - i, premultiplied);
+                    i = end;
+                }
+                current = out;
             }
-            r /= diameter;
-            g /= diameter;
-            b /= diameter;
-            a /= diameter;
-            tmpPx[y * width + x] = SDL_MapRGBA(tmpDetails, nullptr, r, g, b, a);
+
+            if (current != out)
+                for (int y = 0; y < in->h; ++y)
+                    std::memcpy(static_cast<uint8_t*>(out->pixels) + y * out->pitch,
+                                static_cast<const uint8_t*>(in->pixels) + y * in->pitch,
+                                static_cast<size_t>(in->w) * 4);
+        });
+}
+
+Pipeline& Pipeline::addMatrix(const float matrix[4][5])
+{
+    if (m_stages.empty() || m_stages.back().kind != Stage::Kind::MATRIX)
+    {
+        Stage stage;
+        for (int row = 0; row < 4; ++row)
+            for (int col = 0; col < 5; ++col)
+                stage.columns[col][row] = matrix[row][col];
+        m_stages.push_back(stage);
+        return *this;
+    }
+
+    // Fold into the previous matrix: applying A then B equals applying B * A
+    Stage& stage = m_stages.back();
+    float combined[5][4];
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int col = 0; col < 5; ++col)
+        {
+            float sum = col == 4 ? matrix[row][4] : 0.f;
+            for (int k = 0; k < 4; ++k)
+                sum += matrix[row][k] * stage.columns[col][k];
+            combined[col][row] = sum;
         }
+    }
+    std::memcpy(stage.columns, combined, sizeof(combined));
+    return *this;
+}
+} // namespace transform
 
-    // Vertical
-    for (int y = 0; y < height; ++y)
-        for (int x = 0; x < width; ++x)
+// Take a w x h RGBA32 surface from the pool, or create one if none matches
+SDL_Surface* _acquireSurface(const int w, const int h)
+{
+    for (auto it = _surfacePool.rbegin(); it != _surfacePool.rend(); ++it)
+    {
+        SDL_Surface* surface = *it;
+        if (surface->w == w && surface->h == h && surface->format == SDL_PIXELFORMAT_RGBA32)
         {
-            uint8_t r = 0, g = 0, b = 0, a = 0;
-            for (int dy = -radius; dy <= radius; ++dy)
-            {
-                int sy = repeatEdgePixels ? clamp(y + dy, 0, height - 1) : y + dy;
-                if (sy < 0 || sy >= height)
-                    continue;
-                uint8_t pr, pg, pb, pa;
-                SDL_GetRGBA(tmpPx[sy * width + x], tmpDetails, nullptr, &pr, &pg, &pb, &pa);
-                r += pr;
-                g += pg;
-                b += pb;
-                a += pa;
-            }
-            r /= diameter;
-            g /= diameter;
-            b /= diameter;
-            a /= diameter;
-            dstPx[y * width + x] = SDL_MapRGBA(resDetails, nullptr, r, g, b, a);
+            _surfacePool.erase(std::next(it).base());
+            return surface;
         }
+    }
+
+    SDL_Surface* surface = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_RGBA32);
+    if (!surface)
+        throw std::runtime_error("Failed to create surface: " + std::string(SDL_GetError()));
+    return surface;
+}
+
+// Return a surface to the pool with its settings reset, evicting the oldest entry when full
+void _releaseSurface(SDL_Surface* surface)
+{
+    if (!surface)
+        return;
 
-    SDL_DestroySurface(temp);
+    // Surfaces over borrowed memory cannot be recycled
+    if (surface->flags & SDL_SURFACE_PREALLOCATED)
+    {
+        SDL_DestroySurface(surface);
+        return;
+    }
 
-    return std::make_unique<PixelArray>(result);
+    SDL_SetSurfaceRLE(surface, false);
+    SDL_SetSurfaceColorKey(surface, false, 0);
+    SDL_SetSurfaceAlphaMod(surface, 255);
+    SDL_SetSurfaceColorMod(surface, 255, 255, 255);
+    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceClipRect(surface, nullptr);
+
+    _surfacePool.push_back(surface);
+    if (_surfacePool.size() > MAX_POOLED_SURFACES)
+    {
+        SDL_DestroySurface(_surfacePool.front());
+        _surfacePool.erase(_surfacePool.begin());
+    }
 }
 
-std::unique_ptr<PixelArray> gaussianBlur(const PixelArray& pixelArray, int radius, bool repeatEdgePixels)
+// Return the surface itself if it already holds plain RGBA32 pixels, otherwise a converted copy
+// that the caller must release
+SDL_Surface* _toRGBA32(SDL_Surface* surface)
 {
+    if (surface->format == SDL_PIXELFORMAT_RGBA32 && !SDL_SurfaceHasRLE(surface))
+        return surface;
+
+    return pixel_array::_convertRGBA32(surface);
+}
+
+// The pixel array a transform writes into: dst, the input itself when inplace, or nullptr for a
+// new pixel array
+PixelArray* _resolveTarget(const PixelArray& pixelArray, const py::object& dst, const bool inplace)
+{
+    if (inplace && !dst.is_none())
+        throw std::invalid_argument("Cannot use both dst and inplace.");
+
+    if (inplace)
+        return const_cast<PixelArray*>(&pixelArray);
+    if (dst.is_none())
+        return nullptr;
+    return &dst.cast<PixelArray&>();
+}
+
+// Hand a transform result to the caller, carrying over the source's alpha layout. A result
+// surface that is not already the target's is wrapped in a new pixel array, copied into the
+// target when the shape matches so that exported views stay valid, or otherwise swapped into
+// the target, which keeps its surface settings. A swap raises BufferError while the target has
+// a live buffer view
+py::object _deliver(const PixelArray& pixelArray, const py::object& dst, const bool inplace,
+                    PixelArray* target, SDL_Surface* result)
+{
+    if (!target)
+    {
+        auto created = std::make_unique<PixelArray>(result);
+        created->setPremultiplied(pixelArray.isPremultiplied());
+        return py::cast(std::move(created));
+    }
+
+    SDL_Surface* previous = target->getSDL();
+    const bool sameShape = previous->w == result->w && previous->h == result->h &&
+                           previous->format == result->format && !SDL_SurfaceHasRLE(previous);
+
+    // Swapping the surface would free pixels that a NumPy array or memoryview still points at
+    if (result != previous && !sameShape && target->isExported())
+    {
+        _releaseSurface(result);
+        throw py::buffer_error("Cannot write a result of a different size into a pixel array "
+                               "while a buffer view of it is alive");
+    }
+
+    target->setPremultiplied(pixelArray.isPremultiplied());
+
+    if (result != previous && sameShape)
+    {
+        const size_t rowBytes = static_cast<size_t>(result->w) * SDL_BYTESPERPIXEL(result->format);
+        for (int y = 0; y < result->h; ++y)
+            std::memcpy(static_cast<uint8_t*>(previous->pixels) + y * previous->pitch,
+                        static_cast<const uint8_t*>(result->pixels) + y * result->pitch,
+                        rowBytes);
+        _releaseSurface(result);
+    }
+    else if (result != previous)
+    {
+        SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+        Uint8 alpha = 255, r = 255, g = 255, b = 255;
+        SDL_GetSurfaceBlendMode(previous, &blendMode);
+        SDL_GetSurfaceAlphaMod(previous, &alpha);
+        SDL_GetSurfaceColorMod(previous, &r, &g, &b);
+        SDL_SetSurfaceBlendMode(result, blendMode);
+        SDL_SetSurfaceAlphaMod(result, alpha);
+        SDL_SetSurfaceColorMod(result, r, g, b);
+
+        Uint32 key = 0;
+        if (SDL_GetSurfaceColorKey(previous, &key))
+        {
+            Uint8 ka = 255;
+            SDL_GetRGBA(key, SDL_GetPixelFormatDetails(previous->format),
+                        SDL_GetSurfacePalette(previous), &r, &g, &b, &ka);
+            SDL_SetSurfaceColorKey(result, true, SDL_MapSurfaceRGBA(result, r, g, b, ka));
+        }
+
+        _releaseSurface(target->replaceSDL(result));
+    }
+
+    if (inplace)
+        return py::cast(target, py::return_value_policy::reference);
+    return dst;
+}
+
+// Run a kernel that writes a w x h RGBA32 image from the RGBA32 source pixels. The target's own
+// surface is written directly when it already has that shape, unless the kernel cannot read and
+// write the same pixels, in which case it writes a pooled surface that _deliver copies back
+template <typename Kernel>
+py::object _transform(const PixelArray& pixelArray, const py::object& dst, const bool inplace,
+                      const int w, const int h, const bool aliasSafe, Kernel&& kernel)
+{
+    PixelArray* target = _resolveTarget(pixelArray, dst, inplace);
+
     SDL_Surface* src = pixelArray.getSDL();
+    SDL_Surface* in = _toRGBA32(src);
 
-    const int w = src->w, h = src->h;
-    int diameter = radius * 2 + 1;
+    SDL_Surface* out = nullptr;
+    if (target)
+    {
+        SDL_Surface* current = target->getSDL();
+        if (current->w == w && current->h == h && current->format == SDL_PIXELFORMAT_RGBA32 &&
+            !SDL_SurfaceHasRLE(current) && (aliasSafe || current != in))
+            out = current;
+    }
 
-    // Build Gaussian kernel (σ = radius/2)
-    float sigma = radius > 0 ? (radius / 2.0f) : 1.0f;
-    float twoSigmaSq = 2.0f * sigma * sigma;
-    float invSigmaRoot = 1.0f / (std::sqrt(2.0f * M_PI) * sigma);
-    std::vector<float> kernel(diameter);
-    for (int i = 0; i < diameter; ++i)
+    try
     {
-        int x = i - radius;
-        kernel[i] = invSigmaRoot * std::exp(-(x * x) / twoSigmaSq);
-    }
-
-    // Normalize
-    float sum = 0;
-    for (float v : kernel)
-        sum += v;
-    for (float& v : kernel)
-        v /= sum;
-
-    // Create intermediate and output surfaces
-    SDL_Surface* temp = SDL_CreateSurface(w, h, src->format);
-    SDL_Surface* result = SDL_CreateSurface(w, h, src->format);
-    if (!temp)
-        throw std::runtime_error("Failed to create temporary surface for gaussian blur.");
-    if (!result)
-        throw std::runtime_error("Failed to create result surface for gaussian blur.");
-
-    auto clamp = [](int v, int low, int high) -> int { return std::max(low, std::min(v, high)); };
-    Uint32* srcPx = static_cast<Uint32*>(src->pixels);
-    Uint32* tmpPx = static_cast<Uint32*>(temp->pixels);
-    Uint32* dstPx = static_cast<Uint32*>(result->pixels);
-
-    const auto srcDetails = SDL_GetPixelFormatDetails(src->format);
-    const auto tmpDetails = SDL_GetPixelFormatDetails(temp->format);
-    const auto resDetails = SDL_GetPixelFormatDetails(result->format);
-
-    // Horizontal pass
-    for (int y = 0; y < h; ++y)
-        for (int x = 0; x < w; ++x)
+        if (!out)
+            out = _acquireSurface(w, h);
+        kernel(in, out);
+    }
+    catch (...)
+    {
+        if (out && (!target || out != target->getSDL()))
+            _releaseSurface(out);
+        if (in != src)
+            _releaseSurface(in);
+        throw;
+    }
+
+    if (in != src)
+        _releaseSurface(in);
+
+    return _deliver(pixelArray, dst, inplace, target, out);
+}
+
+namespace
+{
+// Write a row of pixels in reverse order. src and dst must not overlap
+inline void _reverseRow(const uint32_t* src, uint32_t* dst, const int width)
+{
+    int x = 0;
+#if defined(KN_SIMD_SSE2)
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + width - 4 - x));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_shuffle_epi32(v, 0x1B));
+    }
+#elif defined(KN_SIMD_NEON)
+    for (; x + 4 <= width; x += 4)
+    {
+        const uint32x4_t v = vrev64q_u32(vld1q_u32(src + width - 4 - x));
+        vst1q_u32(dst + x, vcombine_u32(vget_high_u32(v), vget_low_u32(v)));
+    }
+#endif
+    for (; x < width; ++x)
+        dst[x] = src[width - 1 - x];
+}
+
+// Transpose a 4x4 block of pixels: out[k][i] = in[i][k]
+inline void _transpose4x4(const uint32_t* const in[4], uint32_t* const out[4])
+{
+#if defined(KN_SIMD_SSE2)
+    const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in[0]));
+    const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in[1]));
+    const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in[2]));
+    const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in[3]));
+    const __m128i a0 = _mm_unpacklo_epi32(r0, r1);
+    const __m128i a1 = _mm_unpacklo_epi32(r2, r3);
+    const __m128i a2 = _mm_unpackhi_epi32(r0, r1);
+    const __m128i a3 = _mm_unpackhi_epi32(r2, r3);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out[0]), _mm_unpacklo_epi64(a0, a1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out[1]), _mm_unpackhi_epi64(a0, a1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out[2]), _mm_unpacklo_epi64(a2, a3));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out[3]), _mm_unpackhi_epi64(a2, a3));
+#elif defined(KN_SIMD_NEON)
+    const uint32x4x2_t a = vtrnq_u32(vld1q_u32(in[0]), vld1q_u32(in[1]));
+    const uint32x4x2_t b = vtrnq_u32(vld1q_u32(in[2]), vld1q_u32(in[3]));
+    vst1q_u32(out[0], vcombine_u32(vget_low_u32(a.val[0]), vget_low_u32(b.val[0])));
+    vst1q_u32(out[1], vcombine_u32(vget_low_u32(a.val[1]), vget_low_u32(b.val[1])));
+    vst1q_u32(out[2], vcombine_u32(vget_high_u32(a.val[0]), vget_high_u32(b.val[0])));
+    vst1q_u32(out[3], vcombine_u32(vget_high_u32(a.val[1]), vget_high_u32(b.val[1])));
+#else
+    for (int k = 0; k < 4; ++k)
+        for (int i = 0; i < 4; ++i)
+            out[k][i] = in[i][k];
+#endif
+}
+
+inline const uint32_t* _pixelAt(const SDL_Surface* surface, const int x, const int y)
+{
+    return reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(surface->pixels) +
+                                             y * surface->pitch) +
+           x;
+}
+
+inline uint32_t* _pixelAt(SDL_Surface* surface, const int x, const int y)
+{
+    return reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(surface->pixels) +
+                                       y * surface->pitch) +
+           x;
+}
+} // namespace
+
+// Mirror an RGBA32 surface into a distinct same-sized surface, one whole row at a time
+void _flipPixels(SDL_Surface* in, SDL_Surface* out, const bool flipX, const bool flipY)
+{
+    const int width = in->w;
+    const int height = in->h;
+
+    parallel::forRange(
+        height, 64,
+        [=](const int begin, const int end)
         {
-            float fr = 0, fg = 0, fb = 0, fa = 0;
-            for (int k = 0; k < diameter; ++k)
+            for (int y = begin; y < end; ++y)
             {
-                int sx = x + (k - radius);
-                if (repeatEdgePixels)
-                    sx = clamp(sx, 0, w - 1);
-                if (sx < 0 || sx >= w)
-                    continue;
-
-                Uint8 pr, pg, pb, pa;
-                SDL_GetRGBA(srcPx[y * w + sx], srcDetails, nullptr, &pr, &pg, &pb, &pa);
-                fr += pr * kernel[k];
-                fg += pg * kernel[k];
-                fb += pb * kernel[k];
-                fa += pa * kernel[k];
+                const uint32_t* srcRow = _pixelAt(in, 0, flipY ? height - 1 - y : y);
+                uint32_t* dstRow = _pixelAt(out, 0, y);
+
+                if (flipX)
+                    _reverseRow(srcRow, dstRow, width);
+                else
+                    std::memcpy(dstRow, srcRow, static_cast<size_t>(width) * 4);
             }
-            tmpPx[y * w + x] =
-                SDL_MapRGBA(tmpDetails, nullptr, static_cast<Uint8>(fr), static_cast<Uint8>(fg),
-                            static_cast<Uint8>(fb), static_cast<Uint8>(fa));
-        }
+        });
+}
 
-    // Vertical pass
-    for (int y = 0; y < h; ++y)
-        for (int x = 0; x < w; ++x)
+// Rotate an RGBA32 surface by 90 (turns = 1) or 270 (turns = 3) degrees counter-clockwise into a
+// distinct surface of the transposed size. The output is walked in tiles that keep both the
+// rows written and the rows read cache resident, with 4x4 blocks transposed in registers
+void _rotateQuarter(SDL_Surface* in, SDL_Surface* out, const int turns)
+{
+    constexpr int TILE = 64;
+
+    const int srcW = in->w;
+    const int srcH = in->h;
+    const int dstW = out->w;
+    const int dstH = out->h;
+    const int tileRows = (dstH + TILE - 1) / TILE;
+
+    // Source pixel for destination (x, y)
+    const auto source = [=](const int x, const int y)
+    { return turns == 1 ? _pixelAt(in, srcW - 1 - y, x) : _pixelAt(in, y, srcH - 1 - x); };
+
+    parallel::forRange(
+        tileRows, 1,
+        [=](const int begin, const int end)
         {
-            float fr = 0.f, fg = 0.f, fb = 0.f, fa = 0.f;
-            for (int k = 0; k < diameter; ++k)
+            for (int tileY = begin * TILE; tileY < std::min(end * TILE, dstH); tileY += TILE)
             {
-                int sy = y + (k - radius);
-                if (repeatEdgePixels)
-                    sy = clamp(sy, 0, h - 1);
-                if (sy < 0 || sy >= h)
-                    continue;
-                uint8_t pr, pg, pb, pa;
-                SDL_GetRGBA(tmpPx[sy * w + x], tmpDetails, nullptr, &pr, &pg, &pb, &pa);
-                fr += pr * kernel[k];
-                fg += pg * kernel[k];
-                fb += pb * kernel[k];
-                fa += pa * kernel[k];
+                const int tileBottom = std::min(tileY + TILE, dstH);
+                for (int tileX = 0; tileX < dstW; tileX += TILE)
+                {
+                    const int tileRight = std::min(tileX + TILE, dstW);
+
+                    int y = tileY;
+                    for (; y + 4 <= tileBottom; y += 4)
+                    {
+                        int x = tileX;
+                        for (; x + 4 <= tileRight; x += 4)
+                        {
+                            // Source rows i hold destination column x + i, in source order
+                            const uint32_t* rows[4];
+                            uint32_t* cols[4];
+                            for (int i = 0; i < 4; ++i)
+                            {
+                                if (turns == 1)
+                                {
+                                    rows[i] = _pixelAt(in, srcW - 4 - y, x + i);
+                                    cols[i] = _pixelAt(out, x, y + 3 - i);
+                                }
+                                else
+                                {
+                                    rows[i] = _pixelAt(in, y, srcH - 1 - x - i);
+                                    cols[i] = _pixelAt(out, x, y + i);
+                                }
+                            }
+                            _transpose4x4(rows, cols);
+                        }
+
+                        for (; x < tileRight; ++x)
+                            for (int j = 0; j < 4; ++j)
+                                *_pixelAt(out, x, y + j) = *source(x, y + j);
+                    }
+
+                    for (; y < tileBottom; ++y)
+                        for (int x = tileX; x < tileRight; ++x)
+                            *_pixelAt(out, x, y) = *source(x, y);
+                }
             }
-            dstPx[y * w + x] =
-                SDL_MapRGBA(resDetails, nullptr, static_cast<Uint8>(fr), static_cast<Uint8>(fg),
-                            static_cast<Uint8>(fb), static_cast<Uint8>(fa));
+        });
+}
+
+// Box blur an RGBA32 surface into a same-sized RGBA32 surface, which may be the input itself
+void _boxBlur(SDL_Surface* in, SDL_Surface* out, const int radius, const bool repeatEdgePixels)
+{
+    const int width = in->w;
+    const int height = in->h;
+
+    // Each pass blurs along rows and writes them transposed, so the second pass over the
+    // intermediate is again a row pass and both passes read memory sequentially
+    static thread_local std::vector<uint8_t> transposed;
+    transposed.resize(static_cast<size_t>(width) * height * 4);
+    const int transposedPitch = height * 4;
+
+    _boxBlurPass(static_cast<const uint8_t*>(in->pixels), in->pitch, transposed.data(),
+                 transposedPitch, width, height, radius, repeatEdgePixels);
+    _boxBlurPass(transposed.data(), transposedPitch, static_cast<uint8_t*>(out->pixels),
+                 out->pitch, height, width, radius, repeatEdgePixels);
+}
+
+// Gaussian blur an RGBA32 surface into a same-sized RGBA32 surface, which may be the input itself
+void _gaussianBlur(SDL_Surface* in, SDL_Surface* out, const int radius,
+                   const bool repeatEdgePixels, const BlurQuality quality)
+{
+    const int width = in->w;
+    const int height = in->h;
+    const auto* srcPx = static_cast<const uint8_t*>(in->pixels);
+    auto* dstPx = static_cast<uint8_t*>(out->pixels);
+
+    // Passes write transposed, so each pair of passes blurs both axes (see _boxBlur)
+    static thread_local std::vector<uint8_t> transposed;
+    transposed.resize(static_cast<size_t>(width) * height * 4);
+    const int transposedPitch = height * 4;
+
+    const double sigma = radius > 0 ? radius / 2.0 : 1.0;
+    if (quality == BlurQuality::FAST)
+    {
+        // Three box blurs whose combined variance matches the Gaussian (Kovesi, 2010)
+        const double ideal = std::sqrt(12.0 * sigma * sigma / 3.0 + 1.0);
+        int lower = static_cast<int>(std::floor(ideal));
+        if (lower % 2 == 0)
+            --lower;
+        const int lowerCount =
+            static_cast<int>(std::round((12.0 * sigma * sigma - 3.0 * lower * lower -
+                                         12.0 * lower - 9.0) / (-4.0 * lower - 4.0)));
+
+        for (int i = 0; i < 3; ++i)
+        {
+            const int size = radius == 0 ? 1 : (i < lowerCount ? lower : lower + 2);
+            const int boxRadius = (size - 1) / 2;
+            _boxBlurPass(i == 0 ? srcPx : dstPx, i == 0 ? in->pitch : out->pitch,
+                         transposed.data(), transposedPitch, width, height, boxRadius,
+                         repeatEdgePixels);
+            _boxBlurPass(transposed.data(), transposedPitch, dstPx, out->pitch, height, width,
+                         boxRadius, repeatEdgePixels);
         }
+        return;
+    }
+
+    // Q14 fixed-point kernel (sigma = radius / 2) whose weights sum to exactly 1.0
+    const int diameter = radius * 2 + 1;
+    std::vector<double> weights(diameter);
+    double total = 0.0;
+    for (int i = 0; i < diameter; ++i)
+    {
+        const int x = i - radius;
+        weights[i] = std::exp(-(x * x) / (2.0 * sigma * sigma));
+        total += weights[i];
+    }
 
-    SDL_DestroySurface(temp);
+    std::vector<int16_t> kernel(diameter);
+    int fixedTotal = 0;
+    for (int i = 0; i < diameter; ++i)
+    {
+        kernel[i] = static_cast<int16_t>(std::lround(weights[i] / total * 16384.0));
+        fixedTotal += kernel[i];
+    }
+    kernel[radius] = static_cast<int16_t>(kernel[radius] + 16384 - fixedTotal);
 
-    return std::make_unique<PixelArray>(result);
+    _gaussianPass(srcPx, in->pitch, transposed.data(), transposedPitch, width, height, kernel,
+                  repeatEdgePixels);
+    _gaussianPass(transposed.data(), transposedPitch, dstPx, out->pitch, height, width, kernel,
+                  repeatEdgePixels);
 }
 
-std::unique_ptr<PixelArray> invert(const PixelArray& pixelArray)
+namespace
 {
-    SDL_Surface* src = pixelArray.getSDL();
+using PipelineStage = transform::Pipeline::Stage;
+
+#if defined(KN_SIMD_SSE2)
+// A point stage with its matrix columns splatted into registers; one pixel per vector
+struct PointOp
+{
+    bool threshold;
+    __m128 columns[5];
+    __m128 level;
+};
+
+inline __m128 _loadPixel(const uint32_t px)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_cvtsi32_si128(static_cast<int>(px));
+    v = _mm_unpacklo_epi8(v, zero);
+    v = _mm_unpacklo_epi16(v, zero);
+    return _mm_cvtepi32_ps(v);
+}
+
+inline uint32_t _storePixel(const __m128 v)
+{
+    __m128i i = _mm_cvtps_epi32(v);
+    i = _mm_packs_epi32(i, i);
+    i = _mm_packus_epi16(i, i);
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(i));
+}
 
-    const int w = src->w;
-    const int h = src->h;
+inline uint32_t _applyPoint(const uint32_t px, const PointOp* ops, const size_t count,
+                            const bool premultiplied)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 max = _mm_set1_ps(255.f);
+    const __m128 alphaLane = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
 
-    // Create an output surface matching the source format
-    SDL_Surface* result = SDL_CreateSurface(w, h, src->format);
-    if (!result)
-        throw std::runtime_error("Failed to create result surface for invert.");
+    __m128 v = _loadPixel(px);
+    if (premultiplied)
+    {
+        // Divide the colors by alpha; fully transparent pixels become transparent black
+        const __m128 alpha = _mm_shuffle_ps(v, v, 0xFF);
+        const __m128 scale =
+            _mm_and_ps(_mm_cmpgt_ps(alpha, zero), _mm_div_ps(max, _mm_max_ps(alpha, zero)));
+        v = _mm_or_ps(_mm_and_ps(alphaLane, v),
+                      _mm_andnot_ps(alphaLane, _mm_min_ps(_mm_mul_ps(v, scale), max)));
+    }
 
-    auto srcPx = static_cast<uint32_t*>(src->pixels);
-    auto dstPx = static_cast<uint32_t*>(result->pixels);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const PointOp& op = ops[i];
+        if (op.threshold)
+        {
+            const __m128 t = _mm_and_ps(_mm_cmpge_ps(v, op.level), max);
+            v = _mm_or_ps(_mm_and_ps(alphaLane, v), _mm_andnot_ps(alphaLane, t));
+            continue;
+        }
 
-    auto srcDetails = SDL_GetPixelFormatDetails(src->format);
-    auto resDetails = SDL_GetPixelFormatDetails(result->format);
+        __m128 acc = _mm_add_ps(op.columns[4],
+                                _mm_mul_ps(op.columns[0], _mm_shuffle_ps(v, v, 0x00)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(op.columns[1], _mm_shuffle_ps(v, v, 0x55)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(op.columns[2], _mm_shuffle_ps(v, v, 0xAA)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(op.columns[3], _mm_shuffle_ps(v, v, 0xFF)));
+        v = _mm_min_ps(_mm_max_ps(acc, zero), max);
+    }
 
-    uint8_t r, g, b, a;
-    for (int i = 0; i < w * h; ++i)
+    if (premultiplied)
     {
-        SDL_GetRGBA(srcPx[i], srcDetails, nullptr, &r, &g, &b, &a);
-        dstPx[i] = SDL_MapRGBA(resDetails, nullptr, 255 - r, 255 - g, 255 - b, a);
+        const __m128 alpha = _mm_shuffle_ps(v, v, 0xFF);
+        const __m128 scale = _mm_mul_ps(alpha, _mm_set1_ps(1.f / 255.f));
+        v = _mm_or_ps(_mm_and_ps(alphaLane, v), _mm_andnot_ps(alphaLane, _mm_mul_ps(v, scale)));
     }
+    return _storePixel(v);
+}
 
-    return std::make_unique<PixelArray>(result);
+inline PointOp _pointOp(const PipelineStage& stage)
+{
+    PointOp op;
+    op.threshold = stage.kind == PipelineStage::Kind::THRESHOLD;
+    for (int col = 0; col < 5; ++col)
+        op.columns[col] = _mm_loadu_ps(stage.columns[col]);
+    op.level = _mm_set1_ps(stage.level);
+    return op;
 }
+#elif defined(KN_SIMD_NEON)
+struct PointOp
+{
+    bool threshold;
+    float32x4_t columns[5];
+    float32x4_t level;
+};
 
-std::unique_ptr<PixelArray> grayscale(const PixelArray& pixelArray)
+inline float32x4_t _loadPixel(const uint32_t px)
 {
-    SDL_Surface* src = pixelArray.getSDL();
+    const uint16x8_t wide = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(px)));
+    return vcvtq_f32_u32(vmovl_u16(vget_low_u16(wide)));
+}
 
-    const int w = src->w;
-    const int h = src->h;
+inline uint32_t _storePixel(const float32x4_t v)
+{
+    const uint16x4_t narrow = vqmovn_u32(vcvtq_u32_f32(vaddq_f32(v, vdupq_n_f32(0.5f))));
+    return vget_lane_u32(vreinterpret_u32_u8(vqmovn_u16(vcombine_u16(narrow, narrow))), 0);
+}
+
+inline uint32_t _applyPoint(const uint32_t px, const PointOp* ops, const size_t count,
+                            const bool premultiplied)
+{
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t max = vdupq_n_f32(255.f);
+    const uint32_t lanes[4] = {0, 0, 0, 0xFFFFFFFFu};
+    const uint32x4_t alphaLane = vld1q_u32(lanes);
+
+    float32x4_t v = _loadPixel(px);
+    if (premultiplied)
+    {
+        // Divide the colors by alpha; fully transparent pixels become transparent black
+        const float alpha = vgetq_lane_f32(v, 3);
+        const float32x4_t scaled = vmulq_n_f32(v, alpha > 0.f ? 255.f / alpha : 0.f);
+        v = vbslq_f32(alphaLane, v, vminq_f32(scaled, max));
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const PointOp& op = ops[i];
+        if (op.threshold)
+        {
+            const float32x4_t t = vbslq_f32(vcgeq_f32(v, op.level), max, zero);
+            v = vbslq_f32(alphaLane, v, t);
+            continue;
+        }
 
-    // Create output surface with its own memory
-    SDL_Surface* result = SDL_CreateSurface(w, h, src->format);
-    if (!result)
-        throw std::runtime_error("Failed to create surface for grayscale.");
+        float32x4_t acc = vmlaq_n_f32(op.columns[4], op.columns[0], vgetq_lane_f32(v, 0));
+        acc = vmlaq_n_f32(acc, op.columns[1], vgetq_lane_f32(v, 1));
+        acc = vmlaq_n_f32(acc, op.columns[2], vgetq_lane_f32(v, 2));
+        acc = vmlaq_n_f32(acc, op.columns[3], vgetq_lane_f32(v, 3));
+        v = vminq_f32(vmaxq_f32(acc, zero), max);
+    }
 
-    auto srcPx = static_cast<uint32_t*>(src->pixels);
-    auto dstPx = static_cast<uint32_t*>(result->pixels);
+    if (premultiplied)
+        v = vbslq_f32(alphaLane, v, vmulq_n_f32(v, vgetq_lane_f32(v, 3) / 255.f));
+    return _storePixel(v);
+}
 
-    auto srcDetails = SDL_GetPixelFormatDetails(src->format);
-    auto resDetails = SDL_GetPixelFormatDetails(result->format);
+inline PointOp _pointOp(const PipelineStage& stage)
+{
+    PointOp op;
+    op.threshold = stage.kind == PipelineStage::Kind::THRESHOLD;
+    for (int col = 0; col < 5; ++col)
+        op.columns[col] = vld1q_f32(stage.columns[col]);
+    op.level = vdupq_n_f32(stage.level);
+    return op;
+}
+#else
+using PointOp = PipelineStage;
 
-    uint8_t r, g, b, a;
-    for (int i = 0; i < w * h; ++i)
+inline uint32_t _applyPoint(const uint32_t px, const PointOp* ops, const size_t count,
+                            const bool premultiplied)
+{
+    uint8_t bytes[4];
+    std::memcpy(bytes, &px, 4);
+
+    float v[4];
+    for (int c = 0; c < 4; ++c)
+        v[c] = bytes[c];
+
+    if (premultiplied)
     {
-        SDL_GetRGBA(srcPx[i], srcDetails, nullptr, &r, &g, &b, &a);
-        auto gray = static_cast<uint8_t>(0.299 * r + 0.587 * g + 0.114 * b);
-        dstPx[i] = SDL_MapRGBA(resDetails, nullptr, gray, gray, gray, a);
+        // Divide the colors by alpha; fully transparent pixels become transparent black
+        const float scale = v[3] > 0.f ? 255.f / v[3] : 0.f;
+        for (int c = 0; c < 3; ++c)
+            v[c] = std::min(v[c] * scale, 255.f);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const PointOp& op = ops[i];
+        if (op.kind == PipelineStage::Kind::THRESHOLD)
+        {
+            for (int c = 0; c < 3; ++c)
+                v[c] = v[c] >= op.level ? 255.f : 0.f;
+            continue;
+        }
+
+        float acc[4];
+        for (int c = 0; c < 4; ++c)
+            acc[c] = op.columns[4][c] + op.columns[0][c] * v[0] + op.columns[1][c] * v[1] +
+                     op.columns[2][c] * v[2] + op.columns[3][c] * v[3];
+        for (int c = 0; c < 4; ++c)
+            v[c] = std::min(std::max(acc[c], 0.f), 255.f);
     }
 
-    return std::make_unique<PixelArray>(result);
+    if (premultiplied)
+        for (int c = 0; c < 3; ++c)
+            v[c] *= v[3] / 255.f;
+
+    for (int c = 0; c < 4; ++c)
+        bytes[c] = static_cast<uint8_t>(v[c] + 0.5f);
+
+    uint32_t out;
+    std::memcpy(&out, bytes, 4);
+    return out;
+}
+
+inline PointOp _pointOp(const PipelineStage& stage) { return stage; }
+#endif
+} // namespace
+
+// Apply a run of matrix and threshold stages to every pixel in a single pass. The output may be
+// the input itself. The stages see straight alpha colors, so premultiplied pixels are divided by
+// alpha before them and multiplied again after
+void _pointPass(SDL_Surface* in, SDL_Surface* out, const transform::Pipeline::Stage* stages,
+                const size_t count, const bool premultiplied)
+{
+    std::vector<PointOp> ops;
+    ops.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        ops.push_back(_pointOp(stages[i]));
+
+    const int width = in->w;
+    parallel::forRange(
+        in->h, 16,
+        [&](const int begin, const int end)
+        {
+            for (int y = begin; y < end; ++y)
+            {
+                const auto* srcRow = reinterpret_cast<const uint32_t*>(
+                    static_cast<const uint8_t*>(in->pixels) + y * in->pitch);
+                auto* dstRow = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(out->pixels) +
+                                                           y * out->pitch);
+                for (int x = 0; x < width; ++x)
+                    dstRow[x] = _applyPoint(srcRow[x], ops.data(), count, premultiplied);
+            }
+        });
+}
+
+namespace
+{
+// Weighted sum of RGBA32 pixels. Straight alpha colors are weighted by alpha so that
+// transparent pixels do not bleed their color into the result
+#if defined(KN_SIMD_SSE2)
+class PixelSum
+{
+  public:
+    void add(const uint32_t px, const float weight, const bool premultiplied)
+    {
+        if (!px)
+            return;
+
+        const __m128 color = _loadPixel(px);
+        __m128 scale = _mm_set1_ps(weight);
+        if (!premultiplied)
+        {
+            const float alpha = _mm_cvtss_f32(_mm_shuffle_ps(color, color, 0xFF));
+            const float colorWeight = weight * alpha * (1.f / 255.f);
+            scale = _mm_setr_ps(colorWeight, colorWeight, colorWeight, weight);
+        }
+        m_sum = _mm_add_ps(m_sum, _mm_mul_ps(color, scale));
+    }
+
+    uint32_t result(const bool premultiplied) const
+    {
+        if (premultiplied)
+            return _storePixel(m_sum);
+
+        const float alpha = _mm_cvtss_f32(_mm_shuffle_ps(m_sum, m_sum, 0xFF));
+        if (alpha <= 0.f)
+            return 0;
+        const float scale = 255.f / alpha;
+        return _storePixel(_mm_mul_ps(m_sum, _mm_setr_ps(scale, scale, scale, 1.f)));
+    }
+
+  private:
+    __m128 m_sum = _mm_setzero_ps();
+};
+#elif defined(KN_SIMD_NEON)
+class PixelSum
+{
+  public:
+    void add(const uint32_t px, const float weight, const bool premultiplied)
+    {
+        if (!px)
+            return;
+
+        const float32x4_t color = _loadPixel(px);
+        if (premultiplied)
+        {
+            m_sum = vmlaq_n_f32(m_sum, color, weight);
+            return;
+        }
+
+        const float colorWeight = weight * vgetq_lane_f32(color, 3) * (1.f / 255.f);
+        const float lanes[4] = {colorWeight, colorWeight, colorWeight, weight};
+        m_sum = vmlaq_f32(m_sum, color, vld1q_f32(lanes));
+    }
+
+    uint32_t result(const bool premultiplied) const
+    {
+        if (premultiplied)
+            return _storePixel(m_sum);
+
+        const float alpha = vgetq_lane_f32(m_sum, 3);
+        if (alpha <= 0.f)
+            return 0;
+        const float scale = 255.f / alpha;
+        const float lanes[4] = {scale, scale, scale, 1.f};
+        return _storePixel(vmulq_f32(m_sum, vld1q_f32(lanes)));
+    }
+
+  private:
+    float32x4_t m_sum = vdupq_n_f32(0.f);
+};
+#else
+class PixelSum
+{
+  public:
+    void add(const uint32_t px, const float weight, const bool premultiplied)
+    {
+        if (!px)
+            return;
+
+        uint8_t bytes[4];
+        std::memcpy(bytes, &px, 4);
+        const float colorWeight = premultiplied ? weight : weight * bytes[3] / 255.f;
+        for (int c = 0; c < 3; ++c)
+            m_sum[c] += bytes[c] * colorWeight;
+        m_sum[3] += bytes[3] * weight;
+    }
+
+    uint32_t result(const bool premultiplied) const
+    {
+        float scale = 1.f;
+        if (!premultiplied)
+        {
+            if (m_sum[3] <= 0.f)
+                return 0;
+            scale = 255.f / m_sum[3];
+        }
+
+        uint8_t bytes[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            const float value = c < 3 ? m_sum[c] * scale : m_sum[c];
+            bytes[c] = static_cast<uint8_t>(std::min(std::max(value, 0.f), 255.f) + 0.5f);
+        }
+
+        uint32_t out;
+        std::memcpy(&out, bytes, 4);
+        return out;
+    }
+
+  private:
+    float m_sum[4] = {};
+};
+#endif
+
+inline uint32_t _pixel(const SDL_Surface* surface, const int x, const int y)
+{
+    return reinterpret_cast<const uint32_t*>(static_cast<const uint8_t*>(surface->pixels) +
+                                             y * surface->pitch)[x];
+}
+
+// Bilinear sample of an RGBA32 surface at a continuous source position, where pixel (x, y)
+// covers [x, x + 1) x [y, y + 1). Taps outside the surface are transparent
+inline uint32_t _sampleBilinear(const SDL_Surface* in, const float sx, const float sy,
+                                const bool premultiplied)
+{
+    const float fxPos = sx - 0.5f;
+    const float fyPos = sy - 0.5f;
+    const auto x0 = static_cast<int>(std::floor(fxPos));
+    const auto y0 = static_cast<int>(std::floor(fyPos));
+    if (x0 < -1 || y0 < -1 || x0 >= in->w || y0 >= in->h)
+        return 0;
+
+    const float fx = fxPos - static_cast<float>(x0);
+    const float fy = fyPos - static_cast<float>(y0);
+
+    const auto tap = [in](const int x, const int y) -> uint32_t
+    { return x < 0 || y < 0 || x >= in->w || y >= in->h ? 0 : _pixel(in, x, y); };
+
+    PixelSum sum;
+    sum.add(tap(x0, y0), (1.f - fx) * (1.f - fy), premultiplied);
+    sum.add(tap(x0 + 1, y0), fx * (1.f - fy), premultiplied);
+    sum.add(tap(x0, y0 + 1), (1.f - fx) * fy, premultiplied);
+    sum.add(tap(x0 + 1, y0 + 1), fx * fy, premultiplied);
+    return sum.result(premultiplied);
+}
+
+struct AreaTap
+{
+    int index;
+    float weight;
+};
+
+// Box filter taps for resampling one axis: output cell i covers an equal span of the source and
+// takes every source pixel it overlaps, weighted by the overlap. Cell i's taps are
+// taps[starts[i]] to taps[starts[i + 1] - 1] and their weights sum to 1
+void _areaTaps(const int inSize, const int outSize, std::vector<int>& starts,
+               std::vector<AreaTap>& taps)
+{
+    const double span = static_cast<double>(inSize) / outSize;
+    starts.assign(outSize + 1, 0);
+    taps.clear();
+
+    for (int i = 0; i < outSize; ++i)
+    {
+        const double begin = i * span;
+        const double end = (i + 1) * span;
+        starts[i] = static_cast<int>(taps.size());
+
+        const int last = std::min(inSize, static_cast<int>(std::ceil(end)));
+        for (int j = static_cast<int>(begin); j < last; ++j)
+        {
+            const double overlap = std::min(end, j + 1.0) - std::max(begin, static_cast<double>(j));
+            if (overlap > 1e-9)
+                taps.push_back({j, static_cast<float>(overlap / span)});
+        }
+    }
+    starts[outSize] = static_cast<int>(taps.size());
+}
+} // namespace
+
+// Rotate (counter-clockwise on screen) and scale an RGBA32 surface about its center into a
+// distinct surface. Each destination pixel center maps back into the source, stepping
+// incrementally along rows that are split across the worker pool
+void _rotozoomPixels(SDL_Surface* in, SDL_Surface* out, const double angle, const double scale,
+                     const bool smooth, const bool premultiplied)
+{
+    const double radians = angle * (M_PI / 180.0);
+    const auto cosStep = static_cast<float>(std::cos(radians) / scale);
+    const auto sinStep = static_cast<float>(std::sin(radians) / scale);
+    const float srcCx = in->w * 0.5f;
+    const float srcCy = in->h * 0.5f;
+    const float dstCx = out->w * 0.5f;
+    const float dstCy = out->h * 0.5f;
+
+    parallel::forRange(
+        out->h, 16,
+        [=](const int begin, const int end)
+        {
+            for (int y = begin; y < end; ++y)
+            {
+                auto* dstRow = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(out->pixels) +
+                                                           y * out->pitch);
+                const float u = 0.5f - dstCx;
+                const float v = static_cast<float>(y) + 0.5f - dstCy;
+                float sx = srcCx + cosStep * u - sinStep * v;
+                float sy = srcCy + sinStep * u + cosStep * v;
+
+                for (int x = 0; x < out->w; ++x, sx += cosStep, sy += sinStep)
+                {
+                    if (smooth)
+                    {
+                        dstRow[x] = _sampleBilinear(in, sx, sy, premultiplied);
+                        continue;
+                    }
+
+                    const auto ix = static_cast<int>(std::floor(sx));
+                    const auto iy = static_cast<int>(std::floor(sy));
+                    dstRow[x] =
+                        ix >= 0 && iy >= 0 && ix < in->w && iy < in->h ? _pixel(in, ix, iy) : 0;
+                }
+            }
+        });
+}
+
+// Area-average an RGBA32 surface into a distinct surface of any size. Each destination pixel
+// is the coverage-weighted mean of the source pixels under it, so downscaling does not alias
+void _resampleArea(SDL_Surface* in, SDL_Surface* out, const bool premultiplied)
+{
+    std::vector<int> xStarts, yStarts;
+    std::vector<AreaTap> xTaps, yTaps;
+    _areaTaps(in->w, out->w, xStarts, xTaps);
+    _areaTaps(in->h, out->h, yStarts, yTaps);
+
+    parallel::forRange(
+        out->h, 8,
+        [&](const int begin, const int end)
+        {
+            for (int y = begin; y < end; ++y)
+            {
+                auto* dstRow = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(out->pixels) +
+                                                           y * out->pitch);
+                for (int x = 0; x < out->w; ++x)
+                {
+                    PixelSum sum;
+                    for (int j = yStarts[y]; j < yStarts[y + 1]; ++j)
+                    {
+                        for (int i = xStarts[x]; i < xStarts[x + 1]; ++i)
+                            sum.add(_pixel(in, xTaps[i].index, yTaps[j].index),
+                                    xTaps[i].weight * yTaps[j].weight, premultiplied);
+                    }
+                    dstRow[x] = sum.result(premultiplied);
+                }
+            }
+        });
+}
+
+namespace
+{
+// Running per-channel window sum of RGBA32 pixels for the box blur
+#if defined(KN_SIMD_SSE2)
+struct BoxSum
+{
+    __m128i sum = _mm_setzero_si128();
+
+    static __m128i widen(const uint32_t px)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i bytes = _mm_cvtsi32_si128(static_cast<int>(px));
+        return _mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero);
+    }
+
+    void add(const uint32_t px) { sum = _mm_add_epi32(sum, widen(px)); }
+
+    void sub(const uint32_t px) { sum = _mm_sub_epi32(sum, widen(px)); }
+
+    uint32_t average(const __m128 scale) const
+    {
+        const __m128i avg = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(sum), scale));
+        const __m128i packed = _mm_packs_epi32(avg, avg);
+        return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(packed, packed)));
+    }
+};
+using BoxScale = __m128;
+inline BoxScale _boxScale(const float scale) { return _mm_set1_ps(scale); }
+#elif defined(KN_SIMD_NEON)
+struct BoxSum
+{
+    uint32x4_t sum = vdupq_n_u32(0);
+
+    static uint32x4_t widen(const uint32_t px)
+    {
+        const uint8x8_t bytes = vreinterpret_u8_u32(vdup_n_u32(px));
+        return vmovl_u16(vget_low_u16(vmovl_u8(bytes)));
+    }
+
+    void add(const uint32_t px) { sum = vaddq_u32(sum, widen(px)); }
+
+    void sub(const uint32_t px) { sum = vsubq_u32(sum, widen(px)); }
+
+    uint32_t average(const float32x4_t scale) const
+    {
+        const float32x4_t avg = vmlaq_f32(vdupq_n_f32(0.5f), vcvtq_f32_u32(sum), scale);
+        const uint16x4_t narrow = vmovn_u32(vcvtq_u32_f32(avg));
+        const uint8x8_t bytes = vqmovn_u16(vcombine_u16(narrow, narrow));
+        return vget_lane_u32(vreinterpret_u32_u8(bytes), 0);
+    }
+};
+using BoxScale = float32x4_t;
+inline BoxScale _boxScale(const float scale) { return vdupq_n_f32(scale); }
+#else
+struct BoxSum
+{
+    uint32_t sum[4] = {0, 0, 0, 0};
+
+    void add(const uint32_t px)
+    {
+        for (int c = 0; c < 4; ++c)
+            sum[c] += (px >> (c * 8)) & 0xFF;
+    }
+
+    void sub(const uint32_t px)
+    {
+        for (int c = 0; c < 4; ++c)
+            sum[c] -= (px >> (c * 8)) & 0xFF;
+    }
+
+    uint32_t average(const float scale) const
+    {
+        uint32_t px = 0;
+        for (int c = 0; c < 4; ++c)
+            px |= std::min(255u, static_cast<uint32_t>(sum[c] * scale + 0.5f)) << (c * 8);
+        return px;
+    }
+};
+using BoxScale = float;
+inline BoxScale _boxScale(const float scale) { return scale; }
+#endif
+} // namespace
+
+void _boxBlurPass(const uint8_t* src, const int srcPitch, uint8_t* dst, const int dstPitch,
+                  const int length, const int lines, const int radius,
+                  const bool repeatEdgePixels)
+{
+    const BoxScale scale = _boxScale(1.f / static_cast<float>(radius * 2 + 1));
+
+    parallel::forRange(
+        lines, 16,
+        [=](const int begin, const int end)
+        {
+            for (int line = begin; line < end; ++line)
+            {
+                const auto* row = reinterpret_cast<const uint32_t*>(src + line * srcPitch);
+                uint8_t* out = dst + line * 4;
+
+                // Samples outside the line are either the edge pixel or transparent black
+                auto sample = [&](const int i) -> uint32_t
+                {
+                    if (i >= 0 && i < length)
+                        return row[i];
+                    if (!repeatEdgePixels)
+                        return 0;
+                    return row[i < 0 ? 0 : length - 1];
+                };
+
+                BoxSum window;
+                for (int i = -radius; i <= radius; ++i)
+                    window.add(sample(i));
+
+                for (int i = 0; i < length; ++i)
+                {
+                    const uint32_t px = window.average(scale);
+                    std::memcpy(out + static_cast<ptrdiff_t>(i) * dstPitch, &px, 4);
+                    window.add(sample(i + radius + 1));
+                    window.sub(sample(i - radius));
+                }
+            }
+        });
+}
+
+namespace
+{
+// Weighted sum of RGBA32 pixels against a Q14 fixed-point kernel
+#if defined(KN_SIMD_SSE2)
+inline uint32_t _gaussianPixel(const uint32_t* line, const int32_t* pairWeights, const int pairs)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_set1_epi32(1 << 13);
+    for (int j = 0; j < pairs; ++j)
+    {
+        // Interleave the channels of two neighbouring taps so one madd weights both
+        const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(line + j * 2));
+        const __m128i px = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i taps = _mm_unpacklo_epi16(px, _mm_srli_si128(px, 8));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(taps, _mm_set1_epi32(pairWeights[j])));
+    }
+
+    const __m128i avg = _mm_srai_epi32(acc, 14);
+    const __m128i packed = _mm_packs_epi32(avg, avg);
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(packed, packed)));
+}
+#elif defined(KN_SIMD_NEON)
+inline uint32_t _gaussianPixel(const uint32_t* line, const int16_t* kernel, const int taps)
+{
+    uint32x4_t acc = vdupq_n_u32(1 << 13);
+    for (int k = 0; k < taps; ++k)
+    {
+        const uint8x8_t bytes = vreinterpret_u8_u32(vdup_n_u32(line[k]));
+        acc = vmlal_n_u16(acc, vget_low_u16(vmovl_u8(bytes)), static_cast<uint16_t>(kernel[k]));
+    }
+
+    const uint16x4_t narrow = vshrn_n_u32(acc, 14);
+    const uint8x8_t bytes = vqmovn_u16(vcombine_u16(narrow, narrow));
+    return vget_lane_u32(vreinterpret_u32_u8(bytes), 0);
+}
+#else
+inline uint32_t _gaussianPixel(const uint32_t* line, const int16_t* kernel, const int taps)
+{
+    uint32_t acc[4] = {1 << 13, 1 << 13, 1 << 13, 1 << 13};
+    for (int k = 0; k < taps; ++k)
+        for (int c = 0; c < 4; ++c)
+            acc[c] += ((line[k] >> (c * 8)) & 0xFF) * static_cast<uint32_t>(kernel[k]);
+
+    uint32_t px = 0;
+    for (int c = 0; c < 4; ++c)
+        px |= std::min(255u, acc[c] >> 14) << (c * 8);
+    return px;
+}
+#endif
+} // namespace
+
+void _gaussianPass(const uint8_t* src, const int srcPitch, uint8_t* dst, const int dstPitch,
+                   const int length, const int lines, const std::vector<int16_t>& kernel,
+                   const bool repeatEdgePixels)
+{
+    const auto taps = static_cast<int>(kernel.size());
+    const int radius = taps / 2;
+
+#if defined(KN_SIMD_SSE2)
+    // Pack neighbouring taps as (low, high) int16 pairs for _mm_madd_epi16; an odd tap count
+    // gets a zero-weight partner, so lines carry one extra padding pixel
+    const int pairs = (taps + 1) / 2;
+    std::vector<int32_t> pairWeights(pairs);
+    for (int j = 0; j < pairs; ++j)
+    {
+        const int16_t low = kernel[j * 2];
+        const int16_t high = j * 2 + 1 < taps ? kernel[j * 2 + 1] : 0;
+        const auto packed = static_cast<uint32_t>(static_cast<uint16_t>(low)) |
+                            static_cast<uint32_t>(static_cast<uint16_t>(high)) << 16;
+        pairWeights[j] = static_cast<int32_t>(packed);
+    }
+#endif
+
+    parallel::forRange(
+        lines, 16,
+        [&](const int begin, const int end)
+        {
+            // Each line is copied with its edge padding so the kernel loop has no bounds checks
+            std::vector<uint32_t> padded(static_cast<size_t>(length) + radius * 2 + 1);
+            for (int line = begin; line < end; ++line)
+            {
+                const auto* row = reinterpret_cast<const uint32_t*>(src + line * srcPitch);
+                const uint32_t left = repeatEdgePixels ? row[0] : 0;
+                const uint32_t right = repeatEdgePixels ? row[length - 1] : 0;
+                std::fill(padded.begin(), padded.begin() + radius, left);
+                std::memcpy(padded.data() + radius, row, static_cast<size_t>(length) * 4);
+                std::fill(padded.begin() + radius + length, padded.end(), right);
+
+                uint8_t* out = dst + line * 4;
+                for (int i = 0; i < length; ++i)
+                {
+#if defined(KN_SIMD_SSE2)
+                    const uint32_t px =
+                        _gaussianPixel(padded.data() + i, pairWeights.data(), pairs);
+#else
+                    const uint32_t px = _gaussianPixel(padded.data() + i, kernel.data(), taps);
+#endif
+                    std::memcpy(out + static_cast<ptrdiff_t>(i) * dstPitch, &px, 4);
+                }
+            }
+        });
 }
-} // namespace transform